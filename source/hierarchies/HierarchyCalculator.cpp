@@ -22,23 +22,36 @@
 #include "H9.hpp"
 #include "H9q2.hpp"
 #include "Constants.hpp"
+#include "DSZHiggs.hpp"
+#include "Dual.hpp"
 #include "Logger.hpp"
 #include "Utils.hpp"
 #include "ThresholdCalculator.hpp"
+#include "ThreadPool.hpp"
+#include "Linalg.hpp"
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <future>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
-
-extern "C" void dszhiggs_(double *t, double *mg, double *T1, double *T2, double *st, double *ct, double *q, double *mu, double *tanb,
-      double *v2, double *gs, int *OS, double *S11, double *S22, double *S12);
-
-static bool isInfoPrinted; /**< If this bool is true, than no info will be printed in further runs */
+#include <utility>
 
 /**
  * 	Define static variables
  */
 namespace himalaya {
+
+/** The bits of the expansion flags where all expansion variables are expanded to the full depth */
+constexpr unsigned int ExpansionFlags::FULL;
+
 namespace {
 
 /** The hierarchy map which maps all hierarchies to their mother hierarchies */
@@ -59,6 +72,178 @@ const std::map<int, int> hierarchyMap = {
    { Hierarchies::h9q2   , Hierarchies::h9  }
 };
 
+/** Ensures that the info about Himalaya is printed only once, even if calculators are constructed concurrently */
+std::once_flag isInfoPrinted;
+
+/**
+ * 	Evaluates the expansion terms of a hierarchy at a given loop order.
+ * 	Only the terms of the requested order are evaluated.
+ * 	@param hierarchy the hierarchy object
+ * 	@param loopOrder the loop order (1, 2 or 3)
+ * 	@param sig1 the (1, 1) matrix element at the given loop order
+ * 	@param sig2 the (2, 2) matrix element at the given loop order
+ * 	@param sig12 the (1, 2) = (2, 1) matrix element at the given loop order
+ * 	@param truncations if not null, the terms of the highest order of each truncatable
+ * 	expansion variable are added to the matrices in this vector
+ */
+template <typename T>
+void calcSigmasAtLoopOrder(const T& hierarchy, int loopOrder,
+                           double& sig1, double& sig2, double& sig12,
+                           std::vector<Eigen::Matrix2d>* truncations)
+{
+   decltype(hierarchy.getS1OneLoopTruncations()) trunc1{}, trunc2{}, trunc12{};
+
+   switch (loopOrder) {
+      case 1:
+         sig1 = hierarchy.getS1OneLoop();
+         sig2 = hierarchy.getS2OneLoop();
+         sig12 = hierarchy.getS12OneLoop();
+         if (truncations) {
+            trunc1 = hierarchy.getS1OneLoopTruncations();
+            trunc2 = hierarchy.getS2OneLoopTruncations();
+            trunc12 = hierarchy.getS12OneLoopTruncations();
+         }
+         break;
+      case 2:
+         sig1 = hierarchy.getS1TwoLoop();
+         sig2 = hierarchy.getS2TwoLoop();
+         sig12 = hierarchy.getS12TwoLoop();
+         if (truncations) {
+            trunc1 = hierarchy.getS1TwoLoopTruncations();
+            trunc2 = hierarchy.getS2TwoLoopTruncations();
+            trunc12 = hierarchy.getS12TwoLoopTruncations();
+         }
+         break;
+      case 3:
+         sig1 = hierarchy.getS1ThreeLoop();
+         sig2 = hierarchy.getS2ThreeLoop();
+         sig12 = hierarchy.getS12ThreeLoop();
+         if (truncations) {
+            trunc1 = hierarchy.getS1ThreeLoopTruncations();
+            trunc2 = hierarchy.getS2ThreeLoopTruncations();
+            trunc12 = hierarchy.getS12ThreeLoopTruncations();
+         }
+         break;
+      default:
+         throw std::runtime_error("There are no tree-level hierarchies included!");
+   }
+
+   if (truncations) {
+      truncations->resize(trunc1.size(), Eigen::Matrix2d::Zero());
+      for (std::size_t i = 0; i < trunc1.size(); i++) {
+         (*truncations)[i](0, 0) += trunc1[i];
+         (*truncations)[i](0, 1) += trunc12[i];
+         (*truncations)[i](1, 0) += trunc12[i];
+         (*truncations)[i](1, 1) += trunc2[i];
+      }
+   }
+}
+
+/**
+ * 	Calculates the Higgs mass from the eigenvalues of a CP-even Higgs mass matrix.
+ * 	The NaN root of a negative lowest eigenvalue is not taken, but the root
+ * 	of the highest eigenvalue.
+ * 	@param matrix the real symmetric mass matrix.
+ * 	@param lowestEigenvalue the lowest eigenvalue of the matrix.
+ * 	@return The Higgs mass.
+ */
+double calcHiggsMass(const Eigen::Matrix2d& matrix, double lowestEigenvalue)
+{
+   if (lowestEigenvalue < 0.) {
+      return std::sqrt(matrix.trace() - lowestEigenvalue);
+   }
+
+   return std::sqrt(lowestEigenvalue);
+}
+
+/**
+ * 	Calculates the Higgs mass from a CP-even Higgs mass matrix.
+ * 	@param matrix the real symmetric mass matrix.
+ * 	@return The Higgs mass.
+ */
+double calcHiggsMass(const Eigen::Matrix2d& matrix)
+{
+   return calcHiggsMass(matrix, calcLowestEigenvalue(matrix));
+}
+
+/**
+ * 	The three-loop matrix elements of a hierarchy without the prefactor and its coefficients of the powers of log(mu^2/mst1^2).
+ */
+template <typename T>
+struct ThreeLoopTerms {
+   T S1{};                   ///< diagonal (1, 1) matrix element
+   T S2{};                   ///< diagonal (2, 2) matrix element
+   T S12{};                  ///< off-diagonal (1, 2) matrix element
+   LogCoefficients<T> coefs; ///< coefficients of Mh^2 @ O(at*as^2) without the SM logarithms
+};
+
+/**
+ * 	Calculates the three-loop terms of a hierarchy.
+ * 	@param k the masses and logarithms of the point.
+ * 	@param mdrFlag an int 0 for DR and 1 for MDR scheme.
+ * 	@param withMassMatrix a bool to calculate the matrix elements, otherwise only the log coefficients are calculated.
+ * 	@return The three-loop terms.
+ */
+template <template <typename> class Hierarchy, typename T>
+ThreeLoopTerms<T> calcThreeLoopTerms(const Kinematics<T>& k, int mdrFlag, bool withMassMatrix)
+{
+   const Hierarchy<T> hierarchy(ExpansionFlags(), k, mdrFlag);
+   ThreeLoopTerms<T> terms;
+   if (withMassMatrix) {
+      terms.S1 = hierarchy.getS1ThreeLoop();
+      terms.S2 = hierarchy.getS2ThreeLoop();
+      terms.S12 = hierarchy.getS12ThreeLoop();
+   }
+   terms.coefs = hierarchy.calc_coefs_at_as2_no_sm_logs();
+   return terms;
+}
+
+/**
+ * 	Calculates the three-loop terms of a hierarchy.
+ * 	@param hierarchy the key to the hierarchy.
+ * 	@param k the masses and logarithms of the point.
+ * 	@param mdrFlag an int 0 for DR and 1 for MDR scheme.
+ * 	@param withMassMatrix a bool to calculate the matrix elements, otherwise only the log coefficients are calculated.
+ * 	@throws runtime_error Throws a runtime_error if the hierarchy is not included.
+ * 	@return The three-loop terms.
+ */
+template <typename T>
+ThreeLoopTerms<T> calcThreeLoopTerms(int hierarchy, const Kinematics<T>& k, int mdrFlag, bool withMassMatrix)
+{
+   switch (hierarchy) {
+      case Hierarchies::h3:
+	 return calcThreeLoopTerms<H3>(k, mdrFlag, withMassMatrix);
+      case Hierarchies::h32q2g:
+	 return calcThreeLoopTerms<H32q2g>(k, mdrFlag, withMassMatrix);
+      case Hierarchies::h3q22g:
+	 return calcThreeLoopTerms<H3q22g>(k, mdrFlag, withMassMatrix);
+      case Hierarchies::h4:
+	 return calcThreeLoopTerms<H4>(k, mdrFlag, withMassMatrix);
+      case Hierarchies::h5:
+	 return calcThreeLoopTerms<H5>(k, mdrFlag, withMassMatrix);
+      case Hierarchies::h5g1:
+	 return calcThreeLoopTerms<H5g1>(k, mdrFlag, withMassMatrix);
+      case Hierarchies::h6:
+	 return calcThreeLoopTerms<H6>(k, mdrFlag, withMassMatrix);
+      case Hierarchies::h6g2:
+	 return calcThreeLoopTerms<H6g2>(k, mdrFlag, withMassMatrix);
+      case Hierarchies::h6b:
+	 return calcThreeLoopTerms<H6b>(k, mdrFlag, withMassMatrix);
+      case Hierarchies::h6b2qg2:
+	 return calcThreeLoopTerms<H6b2qg2>(k, mdrFlag, withMassMatrix);
+      case Hierarchies::h6bq22g:
+	 return calcThreeLoopTerms<H6bq22g>(k, mdrFlag, withMassMatrix);
+      case Hierarchies::h6bq2g2:
+	 return calcThreeLoopTerms<H6bq2g2>(k, mdrFlag, withMassMatrix);
+      case Hierarchies::h9:
+	 return calcThreeLoopTerms<H9>(k, mdrFlag, withMassMatrix);
+      case Hierarchies::h9q2:
+	 return calcThreeLoopTerms<H9q2>(k, mdrFlag, withMassMatrix);
+   }
+
+   throw std::runtime_error("Hierarchy " + std::to_string(hierarchy) + " not included!");
+}
+
 } // anonymous namespace
 } // namespace himalaya
 
@@ -72,9 +257,8 @@ himalaya::HierarchyCalculator::HierarchyCalculator(const Parameters& p_,
    : p(p_)
    , verbose(verbose_)
 {
-   if(!isInfoPrinted && verbose){
-      printInfo();
-      isInfoPrinted = true;
+   if(verbose){
+      std::call_once(isInfoPrinted, [this] { printInfo(); });
    }
 
    p.validate(verbose);
@@ -87,12 +271,6 @@ himalaya::HierarchyCalculator::HierarchyCalculator(const Parameters& p_,
  * 	Initializes all common variables.
  */
 void himalaya::HierarchyCalculator::init(){
-   // fill flag list
-   flagMap.clear();
-   for (int i = ExpansionDepth::FIRST; i < ExpansionDepth::NUMBER_OF_EXPANSIONS; i++) {
-      flagMap.emplace(i, 1u);
-   }
-
    // beta
    const double beta = atan(p.vu / p.vd);
 
@@ -113,52 +291,138 @@ void himalaya::HierarchyCalculator::init(){
 
    // prefactor, GF = 1/(sqrt(2) * (vu^2 + vd^2)) (here, GF is calculated in the DRbar scheme, checked)
    prefac = (3. / (sqrt(2) * (pow2(p.vu) + pow2(p.vd)) * sqrt(2) * pow2(Pi) * pow2(sin(beta))));
+
+   // kinematics of the stops (alpha_t) and sbottoms (alpha_b) with the DR'-bar masses
+   for (const bool isAlphab: {false, true}) {
+      Kinematics<double>& k = kinematics[isAlphab];
+      k.Al4p = Al4p;
+      k.Tbeta = tan(beta);
+      k.Sbeta = sin(beta);
+      k.Cbeta = cos(beta);
+      k.scale = p.scale;
+      k.MuSUSY = p.mu;
+      k.At = isAlphab ? p.Ad(2,2) : p.Au(2,2);
+      k.Mt = isAlphab ? p.Mb : p.Mt;
+      k.s2t = isAlphab ? p.s2b : p.s2t;
+      k.Mgl = Mgl;
+      k.Msq = Msq;
+      k.lmMt = log(pow2(p.scale / k.Mt));
+      k.lmMgl = lmMgl;
+      k.lmMsq = lmMsq;
+      k.setStopMasses(isAlphab ? p.MSb(0) : p.MSt(0), isAlphab ? p.MSb(1) : p.MSt(1));
+   }
 }
 
 /**
  * 	Calculates the 3-loop mass matrix and other information of the hierarchy selection process.
  * 	@param isAlphab a bool which determines if the returned object is proportinal to alpha_b.
+ * 	@param resultFields a combination of ResultFields flags, which determines the calculated results besides the hierarchy selection.
  * 	@return A HierarchyObject which holds all information of the calculation.
  */
-himalaya::HierarchyObject himalaya::HierarchyCalculator::calculateDMh3L(bool isAlphab){
+himalaya::HierarchyObject himalaya::HierarchyCalculator::calculateDMh3L(bool isAlphab, unsigned int resultFields) const{
    HierarchyObject ho (isAlphab);
+   ho.setResultFields(resultFields);
+
+   // the memoized exact results of this calculation
+   ExactMassMatrixCache cache;
    
    if (isAlphab)
       INFO_MSG("3-loop threshold correction Δλ not available for O(ab*as^2)!");
    
-   const int mdrFlag = 0;
-   
    // set mdrFlag
-   ho.setMDRFlag(mdrFlag);
+   ho.setMDRFlag(0);
 
    // compare hierarchies and get the best fitting hierarchy
-   compareHierarchies(ho);
+   compareHierarchies(ho, cache);
+
+   calculateDMh3LForSuitableHierarchy(ho, cache);
+
+   return ho;
+}
+
+/**
+ * 	Calculates the 3-loop mass matrix and all other results for the suitable hierarchy, which has been selected by compareHierarchies.
+ * 	Only the result fields of the HierarchyObject are calculated, where EFT implies DLAMBDA and MDR_SHIFT implies DMH.
+ * 	@param ho a HierarchyObject with constant isAlphab and the suitable hierarchy.
+ * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+ */
+void himalaya::HierarchyCalculator::calculateDMh3LForSuitableHierarchy(himalaya::HierarchyObject& ho,
+								       ExactMassMatrixCache& cache) const{
+   unsigned int resultFields = ho.getResultFields();
+   if (resultFields & ResultFields::EFT)
+      resultFields |= ResultFields::DLAMBDA;
+   if (resultFields & ResultFields::MDR_SHIFT)
+      resultFields |= ResultFields::DMH;
+   ho.setResultFields(resultFields);
+
+   // the expansion depth
+   const ExpansionFlags flags;
+
+   const int mdrFlag = ho.getMDRFlag();
    
-   // set Xt order truncation for EFT contribution to be consistent with H3m
-   int xtOrder = 4;
-   const int suitableHierarchy = ho.getSuitableHierarchy();
-   if(suitableHierarchy == himalaya::Hierarchies::h3
-      || suitableHierarchy == himalaya::Hierarchies::h32q2g 
-      || suitableHierarchy == himalaya::Hierarchies::h3q22g
-      || suitableHierarchy == himalaya::Hierarchies::h9
-      || suitableHierarchy == himalaya::Hierarchies::h9q2) xtOrder = 3;
+   // calculate the 3-loop Higgs mass matrix for the obtained hierachy, which sets also the H3m contributions to delta_lambda
+   if (resultFields & (ResultFields::DMH | ResultFields::DLAMBDA)) {
+      const Eigen::Matrix2d dMh3 = calculateHierarchy(ho, 0, 0, 1, flags, nullptr);
+      // the 3-loop Higgs mass matrix in the (M)DRbar' scheme
+      if (resultFields & ResultFields::DMH)
+	 ho.setDMh(3, dMh3 + shiftH3mToDRbarPrime(ho));
+   }
    
-   // calculate the 3-loop Higgs mass matrix for the obtained hierachy in the (M)DRbar' scheme
-   ho.setDMh(3, calculateHierarchy(ho, 0, 0, 1) + shiftH3mToDRbarPrime(ho));
+   if (resultFields & ResultFields::DMH) {
+      // set the alpha_x contributions
+      ho.setDMh(1, getMt41L(ho, mdrFlag, mdrFlag, cache));
    
-   // set the alpha_x contributions
-   ho.setDMh(1, getMt41L(ho, mdrFlag, mdrFlag));
+      // set the alpha_x*alpha_s contributions
+      ho.setDMh(2, getMt42L(ho, mdrFlag, mdrFlag, cache));
+   }
    
-   // set the alpha_x*alpha_s contributions
-   ho.setDMh(2, getMt42L(ho, mdrFlag, mdrFlag));
+   if (resultFields & ResultFields::EXPANSION_UNCERTAINTY) {
+      // estimate the uncertainty of the expansion at 3-loop level
+      ho.setDMhExpUncertainty(3, getExpansionUncertainty(ho,
+						      ho.getDMh(0) + getMt41L(ho, mdrFlag, mdrFlag, cache)
+						      + getMt42L(ho, mdrFlag, mdrFlag, cache), 0, 0, 1, flags));
    
-   // estimate the uncertainty of the expansion at 3-loop level
-   ho.setDMhExpUncertainty(3, getExpansionUncertainty(ho,
-						   ho.getDMh(0) + ho.getDMh(1) + ho.getDMh(2), 0, 0, 1));
+      // set the uncertainty of the expansion at 1-loop level to 0 by default, 
+      // if the user needs this value getExpansionUncertainty should be called
+      ho.setDMhExpUncertainty(1, 0.);
+
+      // set uncertainty of delta_lambda
+      ho.setDLambdaExpUncertainty(ho.getDMhExpUncertainty(3)/std::sqrt(pow2(p.vu) + pow2(p.vd)));
+   }
+
+   if (resultFields & ResultFields::DLAMBDA)
+      calculateDLambdaForSuitableHierarchy(ho, resultFields & ResultFields::EFT);
    
-   // set the uncertainty of the expansion at 1-loop level to 0 by default, 
-   // if the user needs this value getExpansionUncertainty should be called
-   ho.setDMhExpUncertainty(1, 0.);
+   if (resultFields & ResultFields::H3M_SHIFT) {
+      // calculate shifts needed to convert DR' to other renormalization schemes,
+      // here one needs it with the minus sign to convert DR -> H3m
+      ho.setDMhDRbarPrimeToH3mShift(-shiftH3mToDRbarPrime(ho));
+   }
+
+   if (resultFields & ResultFields::MDR_SHIFT) {
+      auto ho_mdr = ho;
+      ho_mdr.setMDRFlag(1);
+      // calculate the DR to MDR shift with the obtained hierarchy
+      ho_mdr.setDMhDRbarPrimeToMDRbarPrimeShift(calcDRbarToMDRbarShift(ho_mdr, true, true, cache));
+      ho_mdr.setDMh(3, calculateHierarchy(ho_mdr, 0, 0, 1, flags, nullptr) + shiftH3mToDRbarPrime(ho_mdr));
+      Eigen::Vector2d mdrMasses;
+      mdrMasses(0) = ho_mdr.getMDRMasses()(0);
+      mdrMasses(1) = ho_mdr.getMDRMasses()(1);
+      ho.setMDRMasses(mdrMasses);
+      ho.setDMhDRbarPrimeToMDRbarPrimeShift(ho_mdr.getDMhDRbarPrimeToMDRbarPrimeShift() 
+	 + ho_mdr.getDMh(3) - ho.getDMh(3));
+   }
+}
+
+/**
+ * 	Calculates delta_lambda, its DR' -> MS shifts and its uncertainties due to missing Xt terms for the suitable hierarchy.
+ * 	Requires the H3m contributions to delta_lambda, which are set by calculateHierarchy.
+ * 	@param ho a HierarchyObject with constant isAlphab and the suitable hierarchy.
+ * 	@param calcEFT a bool to calculate the EFT contributions to the Higgs mass as well.
+ */
+void himalaya::HierarchyCalculator::calculateDLambdaForSuitableHierarchy(himalaya::HierarchyObject& ho, bool calcEFT) const{
+   // set Xt order truncation for EFT contribution to be consistent with H3m
+   const int xtOrder = getXtOrder(ho.getSuitableHierarchy());
 
    // calculate delta_lambda
    // create a modified parameters struct and construct Mh2EFTCalculator and ThresholdCalculator
@@ -166,7 +430,7 @@ himalaya::HierarchyObject himalaya::HierarchyCalculator::calculateDMh3L(bool isA
    p_mass_ES.mu2(2,2) = pow2(p.MSt(0));
    p_mass_ES.mq2(2,2) = pow2(p.MSt(1));
    himalaya::mh2_eft::Mh2EFTCalculator mh2EFTCalculator(p_mass_ES);
-   himalaya::ThresholdCalculator tc (p_mass_ES);
+   himalaya::ThresholdCalculator& tc = mh2EFTCalculator.getThresholdCalculator();
    
    // to obtain delta_lambda one has to divide the difference of the two calculations by v^2
    const double v2 = pow2(p.vu) + pow2(p.vd);
@@ -224,13 +488,6 @@ himalaya::HierarchyObject himalaya::HierarchyCalculator::calculateDMh3L(bool isA
    ho.setDLambdaEFTXtUncertainty(pref*(xt4Flag*tc.getDRbarPrimeToMSbarXtTerms(tc.getLimit(), 4, 1)
       + tc.getDRbarPrimeToMSbarXtTerms(tc.getLimit(), 5, 1)
       + tc.getDRbarPrimeToMSbarXtTerms(tc.getLimit(), 6, 0))/v2);
-   
-   // set uncertainty of delta_lambda
-   ho.setDLambdaExpUncertainty(ho.getDMhExpUncertainty(3)/sqrt(v2));
-   
-   // calculate shifts needed to convert DR' to other renormalization schemes,
-   // here one needs it with the minus sign to convert DR -> H3m
-   ho.setDMhDRbarPrimeToH3mShift(-shiftH3mToDRbarPrime(ho));
 
    // set flags to omit all but O(at*as^n)
    mh2EFTCalculator.setCorrectionFlag(himalaya::EFTOrders::G12G22, 0);
@@ -259,11 +516,13 @@ himalaya::HierarchyObject himalaya::HierarchyCalculator::calculateDMh3L(bool isA
    // 2-Loop prefactor at*as
    const double pref_2L = 1./pow4(4*Pi) * pow2(p.Mt * gt * p.g3);
    // fill in results of EFT calculation
-   ho.setDMh2EFT(0, mh2_eft);
-   ho.setDMh2EFT(1, mh2EFTCalculator.getDeltaMh2EFT1Loop(1, 1));
-   ho.setDMh2EFT(2, mh2EFTCalculator.getDeltaMh2EFT2Loop(1, 1));
-   ho.setDMh2EFT(3, mh2EFTCalculator.getDeltaMh2EFT3Loop(1, 1, 0) 
-      + ho.getDLambdaEFT()*v2);
+   if (calcEFT) {
+      ho.setDMh2EFT(0, mh2_eft);
+      ho.setDMh2EFT(1, mh2EFTCalculator.getDeltaMh2EFT1Loop(1, 1));
+      ho.setDMh2EFT(2, mh2EFTCalculator.getDeltaMh2EFT2Loop(1, 1));
+      ho.setDMh2EFT(3, mh2EFTCalculator.getDeltaMh2EFT3Loop(1, 1, 0) 
+	 + ho.getDLambdaEFT()*v2);
+   }
    ho.setDLambda(0, mh2_eft/v2);
    ho.setDLambda(1, pref_1L*(tc.getThresholdCorrection(
       ThresholdVariables::LAMBDA_AT,RenSchemes::DRBARPRIME, 1))/v2);
@@ -276,19 +535,497 @@ himalaya::HierarchyObject himalaya::HierarchyCalculator::calculateDMh3L(bool isA
       *tc.getThresholdCorrection(ThresholdVariables::YT_AS,
 				 RenSchemes::DRBARPRIME, 1))/v2);
    ho.setDLambdaDRbarPrimeToMSbarShift(3, ho.getDLambdaEFTDRbarPrimeToMSbarShift());
-   mh2EFTCalculator.getDeltaLambdaDegenerate(p.scale, p.MSt(1), p.Au(2,2) - p.mu*p.vd/p.vu,1);
-   auto ho_mdr = ho;
-   ho_mdr.setMDRFlag(1);
-   // calculate the DR to MDR shift with the obtained hierarchy
-   ho_mdr.setDMhDRbarPrimeToMDRbarPrimeShift(calcDRbarToMDRbarShift(ho_mdr, true, true));
-   ho_mdr.setDMh(3, calculateHierarchy(ho_mdr, 0, 0, 1) + shiftH3mToDRbarPrime(ho_mdr));
-   Eigen::Vector2d mdrMasses;
-   mdrMasses(0) = ho_mdr.getMDRMasses()(0);
-   mdrMasses(1) = ho_mdr.getMDRMasses()(1);
-   ho.setMDRMasses(mdrMasses);
-   ho.setDMhDRbarPrimeToMDRbarPrimeShift(ho_mdr.getDMhDRbarPrimeToMDRbarPrimeShift() 
-      + ho_mdr.getDMh(3) - ho.getDMh(3));
-   return ho;
+}
+
+/**
+ * 	Calculates the 3-loop mass matrices and other information of the hierarchy selection process proportional to alpha_t and to alpha_b.
+ * 	Both calculations share the initialization of this calculator and run concurrently on two threads.
+ * 	@param resultFields a combination of ResultFields flags, which determines the calculated results besides the hierarchy selection.
+ * 	@throws The exception of the alpha_t calculation, or of the alpha_b calculation if only the latter failed.
+ * 	@return The HierarchyObjects proportional to alpha_t (0) and alpha_b (1), which are equal to the ones of calculateDMh3L(false) and calculateDMh3L(true).
+ */
+std::array<himalaya::HierarchyObject, 2> himalaya::HierarchyCalculator::calculateDMh3LTopAndBottom(unsigned int resultFields) const{
+   // the alpha_b calculation runs on a second thread, the future is joined when it goes out of scope
+   auto bottom = std::async(std::launch::async, [this, resultFields] {
+      return calculateDMh3L(true, resultFields);
+   });
+
+   HierarchyObject top = calculateDMh3L(false, resultFields);
+
+   return {{std::move(top), bottom.get()}};
+}
+
+/**
+ * 	Calculates delta_lambda at three-loop level, its DR' -> MS shift and its uncertainties without the Higgs mass matrices of the suitable hierarchy.
+ * 	@param withExpUncertainty a bool to estimate the expansion uncertainty, which requires the three-loop Higgs mass matrix.
+ * 	@return The three-loop delta_lambda of the suitable hierarchy, which is equal to HierarchyObject::getDLambda(3).
+ */
+himalaya::DeltaLambda3L himalaya::HierarchyCalculator::calculateDLambda3L(bool withExpUncertainty) const{
+   HierarchyObject ho (false);
+
+   // the memoized exact results of this calculation
+   ExactMassMatrixCache cache;
+
+   ho.setMDRFlag(0);
+
+   // compare hierarchies and get the best fitting hierarchy
+   compareHierarchies(ho, cache);
+
+   const int xtOrder = getXtOrder(ho.getSuitableHierarchy());
+
+   auto p_mass_ES = p;
+   p_mass_ES.mu2(2,2) = pow2(p.MSt(0));
+   p_mass_ES.mq2(2,2) = pow2(p.MSt(1));
+   himalaya::mh2_eft::Mh2EFTCalculator mh2EFTCalculator(p_mass_ES);
+   himalaya::ThresholdCalculator& tc = mh2EFTCalculator.getThresholdCalculator();
+
+   const double v2 = pow2(p.vu) + pow2(p.vd);
+   const double gt = sqrt(2)*p.Mt/std::sqrt(v2);
+   const double pref = 1./pow6(4*Pi) * pow2(p.Mt * gt * pow2(p.g3));
+
+   // the non-logarithmic part without the SM logarithms, see calculateDLambdaForSuitableHierarchy
+   const double subtractionTermEFT = mh2EFTCalculator.getDeltaMh2EFT3Loop(0,0,0);
+   const double eftLogs = pref*(
+      tc.getThresholdCorrection(
+	    ThresholdVariables::LAMBDA_AT_AS2, RenSchemes::DRBARPRIME, 1)
+      - tc.getThresholdCorrection(
+	    ThresholdVariables::LAMBDA_AT_AS2, RenSchemes::DRBARPRIME, 0));
+   const double deltaLambda3LNonLog = pref*(calculateLogCoefficients(ho).log0
+      + shiftH3mToDRbarPrimeMh2(ho,0)) - subtractionTermEFT;
+
+   DeltaLambda3L result;
+   result.hierarchy = ho.getSuitableHierarchy();
+   result.dLambda = (deltaLambda3LNonLog + eftLogs)/v2;
+   result.dLambdaDRbarPrimeToMSbarShift = pref*tc.getDRbarPrimeToMSbarShift(xtOrder,1,0)/v2;
+
+   const int xt4Flag = xtOrder == 3 ? 1 : 0;
+   result.dLambdaXtUncertainty = pref*(xt4Flag*tc.getDRbarPrimeToMSbarXtTerms(tc.getLimit(), 4, 1)
+      + tc.getDRbarPrimeToMSbarXtTerms(tc.getLimit(), 5, 1)
+      + tc.getDRbarPrimeToMSbarXtTerms(tc.getLimit(), 6, 0))/v2;
+
+   if (withExpUncertainty) {
+      const int mdrFlag = ho.getMDRFlag();
+      result.dLambdaExpUncertainty = getExpansionUncertainty(ho,
+	 ho.getDMh(0) + getMt41L(ho, mdrFlag, mdrFlag, cache)
+	 + getMt42L(ho, mdrFlag, mdrFlag, cache), 0, 0, 1, ExpansionFlags())/std::sqrt(v2);
+   }
+
+   return result;
+}
+
+/**
+ * 	Calculates the coefficients of the powers of log(mu^2/mst1^2) of the suitable hierarchy at three-loop level.
+ * 	These are the H3m contributions to delta_lambda, which calculateHierarchy sets together with the Higgs mass matrix.
+ * 	@param ho a HierarchyObject with constant isAlphab and the suitable hierarchy.
+ * 	@return The coefficients of Mh^2 @ O(at*as^2) without the SM logarithms.
+ */
+himalaya::LogCoefficients<double> himalaya::HierarchyCalculator::calculateLogCoefficients(const himalaya::HierarchyObject& ho) const{
+   const int mdrFlag = ho.getMDRFlag();
+
+   // the stop/sbottom masses are shifted as in calculateHierarchy at three-loop level
+   Kinematics<double> k = kinematics[ho.getIsAlphab()];
+   k.setStopMasses(shiftMst1ToMDR(ho, mdrFlag, mdrFlag), shiftMst2ToMDR(ho, mdrFlag, mdrFlag));
+
+   return calcThreeLoopTerms(ho.getSuitableHierarchy(), k, mdrFlag, false).coefs;
+}
+
+/**
+ * 	Returns the Xt order of the EFT contributions to delta_lambda, which is consistent with the H3m result of a hierarchy.
+ * 	@param hierarchy the key to a hierarchy.
+ * 	@return The Xt order 3 or 4.
+ */
+int himalaya::HierarchyCalculator::getXtOrder(int hierarchy) const{
+   if(hierarchy == himalaya::Hierarchies::h3
+      || hierarchy == himalaya::Hierarchies::h32q2g 
+      || hierarchy == himalaya::Hierarchies::h3q22g
+      || hierarchy == himalaya::Hierarchies::h9
+      || hierarchy == himalaya::Hierarchies::h9q2) return 3;
+
+   return 4;
+}
+
+/**
+ * 	Calculates the three-loop Higgs mass matrix and delta_lambda together with their gradients with respect to the GradientVariables
+ * 	for the hierarchy of a HierarchyObject, which is kept fixed.  The hierarchy kernels are evaluated once with dual numbers.
+ * 	The H3m shifts and the threshold corrections of delta_lambda are differentiated with central differences.
+ * 	@param ho a HierarchyObject with constant isAlphab and the suitable hierarchy in the DR' scheme, e.g. returned by calculateDMh3L.
+ * 	@throws runtime_error Throws a runtime_error if the HierarchyObject is in the MDR scheme.
+ * 	@return The three-loop results and their gradients.
+ */
+himalaya::Gradients3L himalaya::HierarchyCalculator::calculateGradients3L(const himalaya::HierarchyObject& ho) const{
+   typedef Dual<GradientVariables::NUMBER_OF_GRADIENT_VARIABLES> D;
+   using namespace GradientVariables;
+
+   if (ho.getMDRFlag() != 0)
+      throw std::runtime_error("Gradients are only available in the DR' scheme!");
+
+   const bool isAlphab = ho.getIsAlphab();
+   const int hierarchy = ho.getSuitableHierarchy();
+
+   // the contributions which are not calculated by the hierarchy kernels
+   struct Remainder {
+      Eigen::Matrix2d DMh3L;
+      double DLambda3L;
+      double Msq;
+   };
+   const auto calcRemainder = [isAlphab, hierarchy] (const Parameters& q) {
+      const HierarchyCalculator hc(q, false);
+      HierarchyObject hoq(isAlphab);
+      hoq.setSuitableHierarchy(hierarchy);
+      hoq.setMDRFlag(0);
+
+      Remainder remainder;
+      remainder.DMh3L = hc.shiftH3mToDRbarPrime(hoq);
+      remainder.Msq = hc.Msq;
+      remainder.DLambda3L = 0.;
+
+      // delta_lambda is not available at O(ab*as^2)
+      if (!isAlphab) {
+	 const Parameters& p = hc.p;
+	 auto p_mass_ES = p;
+	 p_mass_ES.mu2(2,2) = pow2(p.MSt(0));
+	 p_mass_ES.mq2(2,2) = pow2(p.MSt(1));
+	 himalaya::mh2_eft::Mh2EFTCalculator mh2EFTCalculator(p_mass_ES);
+	 himalaya::ThresholdCalculator& tc = mh2EFTCalculator.getThresholdCalculator();
+	 const double v2 = pow2(p.vu) + pow2(p.vd);
+	 const double gt = sqrt(2)*p.Mt/std::sqrt(v2);
+	 const double pref = 1./pow6(4*Pi) * pow2(p.Mt * gt * pow2(p.g3));
+	 const double eftLogs = pref*(
+	    tc.getThresholdCorrection(
+	       ThresholdVariables::LAMBDA_AT_AS2, RenSchemes::DRBARPRIME, 1)
+	    - tc.getThresholdCorrection(
+	       ThresholdVariables::LAMBDA_AT_AS2, RenSchemes::DRBARPRIME, 0));
+	 remainder.DLambda3L = (pref*hc.shiftH3mToDRbarPrimeMh2(hoq,0)
+	    - mh2EFTCalculator.getDeltaMh2EFT3Loop(0,0,0) + eftLogs)/v2;
+      }
+
+      return remainder;
+   };
+
+   // the input parameter of a variable
+   const auto variable = [isAlphab] (Parameters& q, int i) -> double& {
+      switch (i) {
+	 case MST1: return isAlphab ? q.MSb(0) : q.MSt(0);
+	 case MST2: return isAlphab ? q.MSb(1) : q.MSt(1);
+	 case S2T: return isAlphab ? q.s2b : q.s2t;
+	 case MG: return q.MG;
+	 case AT: return isAlphab ? q.Ad(2,2) : q.Au(2,2);
+	 case MU: return q.mu;
+	 case SCALE: return q.scale;
+	 case G3: return q.g3;
+	 case VU: return q.vu;
+	 case VD: return q.vd;
+      }
+      throw std::runtime_error("Gradient variable " + std::to_string(i) + " not included!");
+   };
+
+   // central differences of the remainder
+   const Remainder remainder = calcRemainder(p);
+   std::array<Remainder, NUMBER_OF_GRADIENT_VARIABLES> dRemainder;
+   for (int i = 0; i < NUMBER_OF_GRADIENT_VARIABLES; i++) {
+      Parameters up = p, down = p;
+      const double x = variable(up, i);
+      const double h = std::cbrt(std::numeric_limits<double>::epsilon())*std::max(1., std::abs(x));
+      variable(up, i) = x + h;
+      variable(down, i) = x - h;
+      // the sine of the mixing angle must not leave [-1, 1]
+      if (i == S2T) {
+	 variable(up, i) = std::min(x + h, 1.);
+	 variable(down, i) = std::max(x - h, -1.);
+      }
+      const double dx = variable(up, i) - variable(down, i);
+      const Remainder r1 = calcRemainder(up), r2 = calcRemainder(down);
+      dRemainder[i].DMh3L = (r1.DMh3L - r2.DMh3L)/dx;
+      dRemainder[i].DLambda3L = (r1.DLambda3L - r2.DLambda3L)/dx;
+      dRemainder[i].Msq = (r1.Msq - r2.Msq)/dx;
+   }
+
+   // the variables as dual numbers, mirroring init
+   const D vu = D::variable(p.vu, VU), vd = D::variable(p.vd, VD), g3 = D::variable(p.g3, G3);
+   const D beta = atan(vu / vd);
+   D Msq_ = Msq;
+   for (int i = 0; i < NUMBER_OF_GRADIENT_VARIABLES; i++)
+      Msq_.setDerivative(i, dRemainder[i].Msq);
+
+   const Kinematics<double>& kd = kinematics[isAlphab];
+   Kinematics<D> k;
+   k.Al4p = pow2(g3 / (4 * Pi));
+   k.Tbeta = tan(beta);
+   k.Sbeta = sin(beta);
+   k.Cbeta = cos(beta);
+   k.scale = D::variable(p.scale, SCALE);
+   k.MuSUSY = D::variable(p.mu, MU);
+   k.At = D::variable(kd.At, AT);
+   k.Mt = kd.Mt;
+   k.s2t = D::variable(kd.s2t, S2T);
+   k.Mgl = D::variable(Mgl, MG);
+   k.Msq = Msq_;
+   k.lmMt = log(pow2(k.scale / k.Mt));
+   k.lmMgl = log(pow2(k.scale / k.Mgl));
+   k.lmMsq = log(pow2(k.scale / k.Msq));
+   // the stop/sbottom masses as in calculateHierarchy at three-loop level, which are not shifted in the DR' scheme
+   k.setStopMasses(D::variable(shiftMst1ToMDR(ho, 0, 0), MST1), D::variable(shiftMst2ToMDR(ho, 0, 0), MST2));
+
+   const ThreeLoopTerms<D> terms = calcThreeLoopTerms(hierarchy, k, 0, true);
+   const D prefacD = 3. / (sqrt(2) * (pow2(vu) + pow2(vd)) * sqrt(2) * pow2(Pi) * pow2(sin(beta)));
+   const D S1 = prefacD * terms.S1, S2 = prefacD * terms.S2, S12 = prefacD * terms.S12;
+
+   Gradients3L result;
+   result.hierarchy = hierarchy;
+   result.DMh3L << S1.value(), S12.value(), S12.value(), S2.value();
+   result.DMh3L += remainder.DMh3L;
+   for (int i = 0; i < NUMBER_OF_GRADIENT_VARIABLES; i++) {
+      result.DMh3LGradient[i] << S1.derivative(i), S12.derivative(i), S12.derivative(i), S2.derivative(i);
+      result.DMh3LGradient[i] += dRemainder[i].DMh3L;
+   }
+
+   if (!isAlphab) {
+      const D v2 = pow2(vu) + pow2(vd);
+      const D gt = sqrt(2)*p.Mt/sqrt(v2);
+      const D pref = 1./pow6(4*Pi) * pow2(p.Mt * gt * pow2(g3));
+      const D dLambda = pref*terms.coefs.log0/v2;
+      result.DLambda3L = dLambda.value() + remainder.DLambda3L;
+      for (int i = 0; i < NUMBER_OF_GRADIENT_VARIABLES; i++)
+	 result.DLambda3LGradient[i] = dLambda.derivative(i) + dRemainder[i].DLambda3L;
+   }
+
+   return result;
+}
+
+/**
+ * 	Calculates the three-loop Higgs mass matrix, delta_lambda and the threshold corrections as polynomials in log(mu^2/Mst1^2)
+ * 	for the hierarchy of a HierarchyObject, which is kept fixed.  The results are polynomials of at most third degree, which
+ * 	are interpolated from their values at four renormalization scales.  The hierarchy selection and the exact two-loop
+ * 	mass matrices are not evaluated at these scales.
+ * 	@param ho a HierarchyObject with constant isAlphab and the suitable hierarchy in the DR' scheme, e.g. returned by calculateDMh3L.
+ * 	@throws runtime_error Throws a runtime_error if the HierarchyObject is in the MDR scheme.
+ * 	@return The coefficients of the three-loop results.
+ */
+himalaya::ScaleDependence3L himalaya::HierarchyCalculator::calculateScaleDependence3L(const himalaya::HierarchyObject& ho) const{
+   // the MDR masses depend on the scale beyond the polynomial
+   if (ho.getMDRFlag() != 0)
+      throw std::runtime_error("The scale dependence is only available in the DR' scheme!");
+
+   const bool isAlphab = ho.getIsAlphab();
+
+   ScaleDependence3L result;
+   result.hierarchy = ho.getSuitableHierarchy();
+   result.Mst1 = isAlphab ? p.MSb(0) : p.MSt(0);
+
+   std::array<Eigen::Matrix2d, 4> dMh3L;
+   std::array<double, 4> dLambda3L{};
+
+   for (int i = 0; i < 4; i++) {
+      Parameters q = p;
+      q.scale = result.Mst1 * std::exp(getLogNode(i) / 2.);
+      const HierarchyCalculator hc(q, false);
+      HierarchyObject hoq(isAlphab);
+      hoq.setSuitableHierarchy(result.hierarchy);
+      hoq.setMDRFlag(0);
+
+      // as in calculateDMh3LForSuitableHierarchy, which sets also the H3m contributions to delta_lambda
+      dMh3L[i] = hc.calculateHierarchy(hoq, 0, 0, 1, ExpansionFlags(), nullptr) + hc.shiftH3mToDRbarPrime(hoq);
+
+      // delta_lambda is not available at O(ab*as^2)
+      if (!isAlphab) {
+	 hc.calculateDLambdaForSuitableHierarchy(hoq, false);
+	 dLambda3L[i] = hoq.getDLambda(3);
+      }
+   }
+
+   result.DMh3L = interpolateLogCoefficients(dMh3L);
+   result.DLambda3L = interpolateLogCoefficients(dLambda3L);
+
+   if (!isAlphab) {
+      auto p_mass_ES = p;
+      p_mass_ES.mu2(2,2) = pow2(p.MSt(0));
+      p_mass_ES.mq2(2,2) = pow2(p.MSt(1));
+      himalaya::mh2_eft::Mh2EFTCalculator mh2EFTCalculator(p_mass_ES);
+      result.thresholdCorrections = mh2EFTCalculator.getThresholdCalculator()
+	 .getThresholdCorrectionLogCoefficients(RenSchemes::DRBARPRIME, 1);
+   }
+
+   return result;
+}
+
+/**
+ * 	Calculates delta_lambda and its DR' -> MS shifts as polynomials in Xt for the hierarchy of a HierarchyObject, which is kept fixed.
+ * 	The results are interpolated from their values at XtPolynomial::degree + 1 values of Xt, where sin(2*theta_t) is determined by
+ * 	Xt and the stop masses.  The hierarchy selection and the exact two-loop mass matrices are not evaluated at these values.
+ * 	@param ho a HierarchyObject proportional to alpha_t with the suitable hierarchy in the DR' scheme, e.g. returned by calculateDMh3L(false).
+ * 	@throws runtime_error Throws a runtime_error if the HierarchyObject is proportional to alpha_b or in the MDR scheme.
+ * 	@return The coefficients of delta_lambda and of its shifts.
+ */
+himalaya::XtDependence3L himalaya::HierarchyCalculator::calculateXtDependence3L(const himalaya::HierarchyObject& ho) const{
+   if (ho.getIsAlphab())
+      throw std::runtime_error("delta_lambda is not available at O(ab*as^2)!");
+   if (ho.getMDRFlag() != 0)
+      throw std::runtime_error("The Xt dependence is only available in the DR' scheme!");
+
+   XtDependence3L result;
+   result.hierarchy = ho.getSuitableHierarchy();
+
+   // the range of Xt with |sin(2*theta_t)| <= 1 at fixed stop masses
+   const double range = (pow2(p.MSt(1)) - pow2(p.MSt(0))) / (2 * p.Mt);
+
+   std::array<std::array<double, XtPolynomial::degree + 1>, 4> dLambda;
+   std::array<std::array<double, XtPolynomial::degree + 1>, 4> dLambdaShift;
+
+   for (int i = 0; i <= XtPolynomial::degree; i++) {
+      const double Xt = getXtNode(i, range);
+      Parameters q = p;
+      q.Au(2,2) = Xt + p.mu * p.vd / p.vu;
+      q.s2t = 2 * p.Mt * Xt / (pow2(p.MSt(0)) - pow2(p.MSt(1)));
+      const HierarchyCalculator hc(q, false);
+      HierarchyObject hoq(false);
+      hoq.setSuitableHierarchy(result.hierarchy);
+      hoq.setMDRFlag(0);
+
+      // as in calculateDMh3LForSuitableHierarchy, which sets the H3m contributions to delta_lambda
+      hc.calculateHierarchy(hoq, 0, 0, 1, ExpansionFlags(), nullptr);
+      hc.calculateDLambdaForSuitableHierarchy(hoq, false);
+
+      for (int loops = 0; loops < 4; loops++) {
+	 dLambda[loops][i] = hoq.getDLambda(loops);
+	 dLambdaShift[loops][i] = hoq.getDLambdaDRbarPrimeToMSbarShift(loops);
+      }
+   }
+
+   for (int loops = 0; loops < 4; loops++) {
+      result.DLambda[loops] = interpolateXtPolynomial(dLambda[loops], range);
+      result.DLambdaDRbarPrimeToMSbarShift[loops] = interpolateXtPolynomial(dLambdaShift[loops], range);
+   }
+
+   return result;
+}
+
+/**
+ * 	Calculates the 3-loop mass matrices and other information of the hierarchy selection process for many parameter points in parallel.
+ * 	The parameter points are distributed over a work-stealing thread pool, where each point is calculated by a non-verbose HierarchyCalculator.
+ * 	@param points the Himalaya input parameters of all points.
+ * 	@param isAlphab a bool which determines if the returned objects are proportinal to alpha_b.
+ * 	@param numberOfWorkers the number of worker threads. If 0, the number of hardware threads is used.
+ * 	@param pruneHierarchies a bool to enable the pruning of the hierarchy selection, see setHierarchyPruning.
+ * 	@param resultFields a combination of ResultFields flags, which determines the calculated results besides the hierarchy selection.
+ * 	@throws The exception of the first parameter point whose calculation failed, after all points are calculated.
+ * 	@return A vector of HierarchyObjects, where the i-th element holds all information of the calculation of the i-th point.
+ */
+std::vector<himalaya::HierarchyObject> himalaya::HierarchyCalculator::calculateDMh3L(const std::vector<Parameters>& points,
+										    bool isAlphab,
+										    unsigned int numberOfWorkers,
+										    bool pruneHierarchies,
+										    unsigned int resultFields){
+   ThreadPool pool(numberOfWorkers);
+   return calculateDMh3L(points, isAlphab, pool, pruneHierarchies, resultFields);
+}
+
+/**
+ * 	Calculates the 3-loop mass matrices and other information of the hierarchy selection process for many parameter points in parallel.
+ * 	The points are screened for their suitable hierarchies first.  Afterwards the hierarchy candidates and finally the selected
+ * 	hierarchies are evaluated bucket by bucket, such that the points of the same hierarchy are calculated one after the other.
+ * 	The work of each stage is distributed over the given thread pool, where each point is calculated by a non-verbose HierarchyCalculator.
+ * 	@param points the Himalaya input parameters of all points.
+ * 	@param isAlphab a bool which determines if the returned objects are proportinal to alpha_b.
+ * 	@param pool the thread pool, which can be reused for several batches.
+ * 	@param pruneHierarchies a bool to enable the pruning of the hierarchy selection, see setHierarchyPruning.
+ * 	@param resultFields a combination of ResultFields flags, which determines the calculated results besides the hierarchy selection.
+ * 	@throws The exception of the first parameter point whose calculation failed, after all points are calculated.
+ * 	@return A vector of HierarchyObjects, where the i-th element holds all information of the calculation of the i-th point.
+ */
+std::vector<himalaya::HierarchyObject> himalaya::HierarchyCalculator::calculateDMh3L(const std::vector<Parameters>& points,
+										    bool isAlphab,
+										    ThreadPool& pool,
+										    bool pruneHierarchies,
+										    unsigned int resultFields){
+   const std::size_t numberOfPoints = points.size();
+   std::vector<HierarchyObject> results(numberOfPoints, HierarchyObject(isAlphab));
+   std::vector<std::unique_ptr<const HierarchyCalculator>> calculators(numberOfPoints);
+   std::vector<ExactMassMatrixCache> caches(numberOfPoints);
+   std::vector<HierarchyErrors> hierarchyErrors(numberOfPoints);
+   std::vector<std::exception_ptr> errors(numberOfPoints);
+   // the points of each hierarchy candidate
+   std::vector<std::vector<std::size_t>> buckets(Hierarchies::NUMBER_OF_HIERARCHIES);
+
+   if (isAlphab)
+      INFO_MSG("3-loop threshold correction Δλ not available for O(ab*as^2)!");
+
+   // Each task writes only to its own elements of the vectors above.  A
+   // failed point is skipped in the subsequent stages.
+   const auto runTasks = [&pool, &errors] (const std::vector<std::size_t>& indices,
+					   const std::function<void(std::size_t)>& task) {
+      pool.run(indices.size(), [&indices, &errors, &task] (std::size_t k) {
+	 const std::size_t i = indices[k];
+	 if (errors[i]) {
+	    return;
+	 }
+	 try {
+	    task(i);
+	 } catch (...) {
+	    errors[i] = std::current_exception();
+	 }
+      });
+   };
+
+   std::vector<std::size_t> allPoints(numberOfPoints);
+   std::iota(allPoints.begin(), allPoints.end(), 0);
+
+   // screen the points for the suitable hierarchies
+   std::vector<std::vector<int>> candidates(numberOfPoints);
+   runTasks(allPoints, [&] (std::size_t i) {
+      calculators[i].reset(new HierarchyCalculator(points[i], false));
+      results[i].setMDRFlag(0);
+      results[i].setResultFields(resultFields);
+      results[i].setDMh(0, calculators[i]->getTreeLevelMassMatrix());
+      for (int hierarchy = Hierarchies::FIRST; hierarchy < Hierarchies::NUMBER_OF_HIERARCHIES; hierarchy++) {
+	 results[i].setSuitableHierarchy(hierarchy);
+	 if (calculators[i]->isHierarchySuitable(results[i])) {
+	    candidates[i].push_back(hierarchy);
+	 }
+      }
+   });
+
+   for (std::size_t i = 0; i < numberOfPoints; i++) {
+      for (const int hierarchy: candidates[i]) {
+	 buckets[hierarchy].push_back(i);
+      }
+   }
+
+   // estimate the errors of the hierarchy candidates bucket by bucket in
+   // ascending order, as done by compareHierarchies for a single point.
+   // With pruning only the two-loop deviations are estimated here.
+   for (int hierarchy = Hierarchies::FIRST; hierarchy < Hierarchies::NUMBER_OF_HIERARCHIES; hierarchy++) {
+      runTasks(buckets[hierarchy], [&] (std::size_t i) {
+	 results[i].setSuitableHierarchy(hierarchy);
+	 hierarchyErrors[i].emplace_back(hierarchy, pruneHierarchies
+					 ? calculators[i]->estimateTwoLoopError(results[i], caches[i])
+					 : calculators[i]->estimateHierarchyError(results[i], caches[i]));
+      });
+   }
+
+   // select the best fitting hierarchies and sort the points by them
+   runTasks(allPoints, [&] (std::size_t i) {
+      results[i].setSkippedUncertaintyEstimates(pruneHierarchies
+						? calculators[i]->pruneHierarchyCandidates(results[i], hierarchyErrors[i], caches[i])
+						: 0);
+      calculators[i]->selectHierarchy(results[i], hierarchyErrors[i]);
+   });
+
+   std::stable_sort(allPoints.begin(), allPoints.end(), [&results] (std::size_t a, std::size_t b) {
+      return results[a].getSuitableHierarchy() < results[b].getSuitableHierarchy();
+   });
+
+   // calculate the selected hierarchies, the pool assigns contiguous blocks of points to the workers
+   runTasks(allPoints, [&] (std::size_t i) {
+      calculators[i]->calculateDMh3LForSuitableHierarchy(results[i], caches[i]);
+   });
+
+   for (const auto& error: errors) {
+      if (error) {
+         std::rethrow_exception(error);
+      }
+   }
+
+   return results;
 }
 
 /**
@@ -296,13 +1033,64 @@ himalaya::HierarchyObject himalaya::HierarchyCalculator::calculateDMh3L(bool isA
  * 	@param ho a HierarchyObject with constant isAlphab.
  * 	@return An integer which is identified with the suitable hierarchy.
  */
-int himalaya::HierarchyCalculator::compareHierarchies(himalaya::HierarchyObject& ho){
-   // set flags to truncate the expansion
-   flagMap.at(ExpansionDepth::xx) = 0;
-   flagMap.at(ExpansionDepth::xxMst) = 0;
-   double error = -1.;
-   int suitableHierarchy = -1;
-   
+int himalaya::HierarchyCalculator::compareHierarchies(himalaya::HierarchyObject& ho) const{
+   ExactMassMatrixCache cache;
+   return compareHierarchies(ho, cache);
+}
+
+/**
+ * 	Compares deviation of all hierarchies with the exact two-loop result and returns the hierarchy which minimizes the error.
+ * 	@param ho a HierarchyObject with constant isAlphab.
+ * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+ * 	@return An integer which is identified with the suitable hierarchy.
+ */
+int himalaya::HierarchyCalculator::compareHierarchies(himalaya::HierarchyObject& ho,
+						      ExactMassMatrixCache& cache) const{
+   ho.setDMh(0, getTreeLevelMassMatrix());
+
+   // compare the exact higgs mass at 2-loop level with the expanded expressions to find a suitable hierarchy
+   HierarchyErrors hierarchyErrors;
+   for (int hierarchy = Hierarchies::FIRST; hierarchy < Hierarchies::NUMBER_OF_HIERARCHIES; hierarchy++) {
+      // first, check if the hierarchy is suitable to the mass spectrum
+      ho.setSuitableHierarchy(hierarchy);
+      
+      if(isHierarchySuitable(ho)){
+	 hierarchyErrors.emplace_back(hierarchy, pruneHierarchies
+				      ? estimateTwoLoopError(ho, cache)
+				      : estimateHierarchyError(ho, cache));
+      }
+   }
+
+   ho.setSkippedUncertaintyEstimates(pruneHierarchies
+				     ? pruneHierarchyCandidates(ho, hierarchyErrors, cache)
+				     : 0);
+
+   return selectHierarchy(ho, hierarchyErrors);
+}
+
+/**
+ * 	Enables or disables the pruning of the hierarchy selection. If enabled, the expansion uncertainties of a hierarchy candidate
+ * 	are only estimated if its deviation from the exact two-loop result does not exceed the error of the best candidate found so far.
+ * 	The selected hierarchy and its errors are the same as without pruning.
+ * 	@param prune a bool to enable (true) or disable (false) the pruning.
+ */
+void himalaya::HierarchyCalculator::setHierarchyPruning(bool prune){
+   pruneHierarchies = prune;
+}
+
+/**
+ * 	@return The combined error, which is minimized by the hierarchy selection.
+ */
+double himalaya::HierarchyCalculator::HierarchyError::getCombinedError() const{
+   // add these errors to include the error of the expansion in the comparison
+   return sqrt(pow2(twoLoopError) + pow2(expUncertainty2L) + pow2(expUncertainty3L));
+}
+
+/**
+ * 	Calculates the tree-level Higgs mass matrix.
+ * 	@return The tree-level CP-even Higgs mass matrix.
+ */
+Eigen::Matrix2d himalaya::HierarchyCalculator::getTreeLevelMassMatrix() const{
    // sine of 2 times beta
    const double s2b = sin(2*atan(p.vu/p.vd));
    const double tbeta = p.vu/p.vd;
@@ -313,74 +1101,179 @@ int himalaya::HierarchyCalculator::compareHierarchies(himalaya::HierarchyObject&
    treelvl (1,0) = s2b/2.*(-pow2(p.MZ) - pow2(p.MA));
    treelvl (0,1) = treelvl (1,0);
    treelvl (1,1) = s2b/2.*(pow2(p.MZ) * tbeta + pow2(p.MA) / tbeta);
+
+   return treelvl;
+}
+
+/**
+ * 	Estimates the error of a hierarchy candidate by comparing the expanded with the exact two-loop Higgs mass.
+ * 	@param ho a HierarchyObject with constant isAlphab, the tree-level mass matrix and the hierarchy candidate.
+ * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+ * 	@return The deviation from the exact two-loop Higgs mass and the uncertainties of the expansion.
+ */
+himalaya::HierarchyCalculator::HierarchyError himalaya::HierarchyCalculator::estimateHierarchyError(himalaya::HierarchyObject& ho,
+												 ExactMassMatrixCache& cache) const{
+   HierarchyError result = estimateTwoLoopError(ho, cache);
+   estimateExpansionUncertainties(ho, result, cache);
+   return result;
+}
+
+/**
+ * 	Compares the expanded with the exact two-loop Higgs mass of a hierarchy candidate.
+ * 	@param ho a HierarchyObject with constant isAlphab, the tree-level mass matrix and the hierarchy candidate.
+ * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+ * 	@return The deviation from the exact two-loop Higgs mass, without the uncertainties of the expansion.
+ */
+himalaya::HierarchyCalculator::HierarchyError himalaya::HierarchyCalculator::estimateTwoLoopError(himalaya::HierarchyObject& ho,
+											       ExactMassMatrixCache& cache) const{
+   // set flags to truncate the expansion
+   ExpansionFlags flags;
+   flags.set(ExpansionDepth::xx, 0);
+   flags.set(ExpansionDepth::xxMst, 0);
+
+   const Eigen::Matrix2d treelvl = ho.getDMh(0);
+
+   // calculate the exact 1-loop result (only alpha_t/b)
+   const Eigen::Matrix2d Mt41L = getMt41L(ho, ho.getMDRFlag(), 0, cache);
+   
+   // call the routine of Pietro Slavich to get the alpha_s alpha_t/b corrections with the MDRbar masses
+   const Eigen::Matrix2d Mt42L = getMt42L(ho, ho.getMDRFlag(), 0, cache);
    
-   ho.setDMh(0, treelvl);
+   // Note: spurious poles are handled by the validate method
+   // of the Himalaya_Interface struct
+   
+   HierarchyError result;
 
-   // compare the exact higgs mass at 2-loop level with the expanded expressions to find a suitable hierarchy
-   for (int hierarchy = Hierarchies::FIRST; hierarchy < Hierarchies::NUMBER_OF_HIERARCHIES; hierarchy++) {
-      // first, check if the hierarchy is suitable to the mass spectrum
-      ho.setSuitableHierarchy(hierarchy);
-      
-      if(isHierarchySuitable(ho)){
-	 // calculate the exact 1-loop result (only alpha_t/b)
-	 const Eigen::Matrix2d Mt41L = getMt41L(ho, ho.getMDRFlag(), 0);
-	 
-	 // call the routine of Pietro Slavich to get the alpha_s alpha_t/b corrections with the MDRbar masses
-	 const Eigen::Matrix2d Mt42L = getMt42L(ho, ho.getMDRFlag(), 0);
-	 
-	 // Note: spurious poles are handled by the validate method
-	 // of the Himalaya_Interface struct
-	 
-	 //calculate the exact Higgs mass at 2-loop (only up to alpha_s alpha_t/b)
-	 const Eigen::EigenSolver<Eigen::Matrix2d> es2L (treelvl + Mt41L + Mt42L);
-	 const double Mh2l = sortEigenvalues(es2L).at(0);
-
-	 // calculate the expanded 2-loop expression with the specific hierarchy
-	 const Eigen::EigenSolver<Eigen::Matrix2d> esExpanded (treelvl + Mt41L 
-	    + calculateHierarchy(ho, 0, 1, 0));
-	 
-	 // calculate the higgs mass in the given mass hierarchy and compare the result to estimate the error
-	 const double Mh2LExpanded = sortEigenvalues(esExpanded).at(0);
-
-	 // estimate the error
-	 const double twoLoopError = std::abs((Mh2l - Mh2LExpanded));
-
-	 // estimate the uncertainty of the expansion at 2L
-	 const double expUncertainty2L = getExpansionUncertainty(ho, treelvl 
-	    + Mt41L, 0, 1, 0);
-
-	 // estimate the uncertainty of the expansion at 3L
-	 const double expUncertainty3L = getExpansionUncertainty(ho, treelvl
-	    + Mt41L + Mt42L, 0, 0, 1); 
-
-	 // add these errors to include the error of the expansion in the comparison
-	 const double currError = sqrt(pow2(twoLoopError) 
-	    + pow2(expUncertainty2L) + pow2(expUncertainty3L));
-
-	 // if the error is negative, it is the first iteration and there is no hierarchy which fits better
-	 if(error < 0){
-	    error = currError;
-	    suitableHierarchy = hierarchy;
-	    ho.setAbsDiff2L(twoLoopError);
-	    ho.setRelDiff2L(twoLoopError/Mh2l);
-	    ho.setDMhExpUncertainty(2, expUncertainty2L);
-	    ho.setDMhExpUncertainty(3, expUncertainty3L);
-	 }
-	 // compare the current error with the last error and choose the hierarchy which fits best (lowest error)
-	 else if(currError < error){
-	    error = currError;
-	    suitableHierarchy = hierarchy;
-	    ho.setAbsDiff2L(twoLoopError);
-	    ho.setRelDiff2L(twoLoopError/Mh2l);
-	    ho.setDMhExpUncertainty(2, expUncertainty2L);
-	    ho.setDMhExpUncertainty(3, expUncertainty3L);
-	 }
+   //calculate the exact Higgs mass at 2-loop (only up to alpha_s alpha_t/b)
+   result.Mh2l = calcHiggsMass(treelvl + Mt41L + Mt42L);
+
+   // calculate the expanded 2-loop expression with the specific hierarchy
+   const Eigen::Matrix2d MhExpanded = treelvl + Mt41L
+      + calculateHierarchy(ho, 0, 1, 0, flags, nullptr);
+   
+   // calculate the higgs mass in the given mass hierarchy and compare the result to estimate the error
+   const double Mh2LExpanded = calcHiggsMass(MhExpanded);
+
+   // estimate the error
+   result.twoLoopError = std::abs((result.Mh2l - Mh2LExpanded));
+
+   return result;
+}
+
+/**
+ * 	Estimates the uncertainties of the expansion of a hierarchy candidate at two- and three-loop level.
+ * 	@param ho a HierarchyObject with constant isAlphab, the tree-level mass matrix and the hierarchy candidate.
+ * 	@param error the error of the hierarchy candidate, whose uncertainties of the expansion are set.
+ * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+ */
+void himalaya::HierarchyCalculator::estimateExpansionUncertainties(himalaya::HierarchyObject& ho, HierarchyError& error,
+								   ExactMassMatrixCache& cache) const{
+   // set flags to truncate the expansion
+   ExpansionFlags flags;
+   flags.set(ExpansionDepth::xx, 0);
+   flags.set(ExpansionDepth::xxMst, 0);
+
+   const Eigen::Matrix2d treelvl = ho.getDMh(0);
+   const Eigen::Matrix2d Mt41L = getMt41L(ho, ho.getMDRFlag(), 0, cache);
+   const Eigen::Matrix2d Mt42L = getMt42L(ho, ho.getMDRFlag(), 0, cache);
+
+   // estimate the uncertainty of the expansion at 2L
+   error.expUncertainty2L = getExpansionUncertainty(ho, treelvl 
+      + Mt41L, 0, 1, 0, flags);
+
+   // estimate the uncertainty of the expansion at 3L
+   error.expUncertainty3L = getExpansionUncertainty(ho, treelvl
+      + Mt41L + Mt42L, 0, 0, 1, flags);
+}
+
+/**
+ * 	Estimates the uncertainties of the expansion only for those hierarchy candidates which can still have the lowest error.
+ * 	The candidates are visited in ascending order of their two-loop deviation, which is a lower bound of their combined error.
+ * 	@param ho a HierarchyObject with constant isAlphab and the tree-level mass matrix.
+ * 	@param hierarchyErrors the two-loop deviations of all hierarchy candidates in ascending order of the hierarchies.
+ * 	The skipped candidates, which cannot be selected, are removed.
+ * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+ * 	@return The number of skipped estimates of the expansion uncertainty.
+ */
+int himalaya::HierarchyCalculator::pruneHierarchyCandidates(himalaya::HierarchyObject& ho, HierarchyErrors& hierarchyErrors,
+							    ExactMassMatrixCache& cache) const{
+   // NaN deviations are visited last
+   const auto key = [&hierarchyErrors] (std::size_t i) {
+      const double twoLoopError = hierarchyErrors[i].second.twoLoopError;
+      return std::isnan(twoLoopError) ? std::numeric_limits<double>::infinity() : twoLoopError;
+   };
+
+   std::vector<std::size_t> order(hierarchyErrors.size());
+   std::iota(order.begin(), order.end(), 0);
+   std::stable_sort(order.begin(), order.end(), [&key] (std::size_t a, std::size_t b) {
+      return key(a) < key(b);
+   });
+
+   double bestError = -1.;
+   int skipped = 0;
+   std::vector<bool> isEvaluated(hierarchyErrors.size(), false);
+
+   for (const std::size_t i: order) {
+      HierarchyError& error = hierarchyErrors[i].second;
+
+      // The combined error is not smaller than the two-loop deviation, so
+      // this candidate cannot be selected.  The first candidate in
+      // ascending order of the hierarchies is always evaluated, because it
+      // is selected by compareHierarchies if its combined error is NaN.
+      if (i != 0 && bestError >= 0 && error.twoLoopError > bestError) {
+	 skipped += 2;
+	 continue;
+      }
+
+      ho.setSuitableHierarchy(hierarchyErrors[i].first);
+      estimateExpansionUncertainties(ho, error, cache);
+      isEvaluated[i] = true;
+
+      const double currError = error.getCombinedError();
+      if (bestError < 0 || currError < bestError) {
+	 bestError = currError;
+      }
+   }
+
+   // remove the skipped candidates, keeping the order of the hierarchies
+   HierarchyErrors evaluated;
+   for (std::size_t i = 0; i < hierarchyErrors.size(); i++) {
+      if (isEvaluated[i]) {
+	 evaluated.push_back(hierarchyErrors[i]);
+      }
+   }
+   hierarchyErrors.swap(evaluated);
+
+   return skipped;
+}
+
+/**
+ * 	Selects the hierarchy candidate with the lowest error and stores it together with its errors in the HierarchyObject.
+ * 	@param ho a HierarchyObject with constant isAlphab.
+ * 	@param hierarchyErrors the errors of all hierarchy candidates in ascending order of the hierarchies.
+ * 	@return An integer which is identified with the suitable hierarchy, or -1 if there are no candidates.
+ */
+int himalaya::HierarchyCalculator::selectHierarchy(himalaya::HierarchyObject& ho,
+						   const HierarchyErrors& hierarchyErrors) const{
+   double error = -1.;
+   int suitableHierarchy = -1;
+
+   for (const auto& candidate: hierarchyErrors) {
+      const HierarchyError& err = candidate.second;
+      const double currError = err.getCombinedError();
+
+      // if the error is negative, it is the first iteration and there is no hierarchy which fits better,
+      // otherwise compare the current error with the last error and choose the hierarchy which fits best (lowest error)
+      if(error < 0 || currError < error){
+	 error = currError;
+	 suitableHierarchy = candidate.first;
+	 ho.setAbsDiff2L(err.twoLoopError);
+	 ho.setRelDiff2L(err.twoLoopError/err.Mh2l);
+	 ho.setDMhExpUncertainty(2, err.expUncertainty2L);
+	 ho.setDMhExpUncertainty(3, err.expUncertainty3L);
       }
    }
    ho.setSuitableHierarchy(suitableHierarchy);
-   // reset the flags
-   flagMap.at(ExpansionDepth::xx) = 1;
-   flagMap.at(ExpansionDepth::xxMst) = 1;
    return suitableHierarchy;
 }
 
@@ -389,7 +1282,7 @@ int himalaya::HierarchyCalculator::compareHierarchies(himalaya::HierarchyObject&
  * 	@param ho a HierarchyObject with constant isAlphab and a hierarchy candidate.
  * 	@returns A bool if the hierarchy candidate is suitable to the given mass spectrum.
  */
-bool himalaya::HierarchyCalculator::isHierarchySuitable(const himalaya::HierarchyObject& ho){
+bool himalaya::HierarchyCalculator::isHierarchySuitable(const himalaya::HierarchyObject& ho) const{
    double Mst1, Mst2;
    if(!ho.getIsAlphab()){
       Mst1 = p.MSt(0);
@@ -450,28 +1343,40 @@ bool himalaya::HierarchyCalculator::isHierarchySuitable(const himalaya::Hierarch
  * 	@return The loop corrected Higgs mass matrix which contains the expanded corrections at the given order.
  */
 Eigen::Matrix2d himalaya::HierarchyCalculator::calculateHierarchy(himalaya::HierarchyObject& ho, const int oneLoopFlagIn,
-								  const int twoLoopFlagIn, const int threeLoopFlagIn) {
+								  const int twoLoopFlagIn, const int threeLoopFlagIn) const {
+   return calculateHierarchy(ho, oneLoopFlagIn, twoLoopFlagIn, threeLoopFlagIn, ExpansionFlags(), nullptr);
+}
+
+/**
+ * 	Calculates the hierarchy contributions for a specific hierarchy at a specific loop order
+ * 	together with the terms of the highest order of each truncatable expansion variable.
+ * 	@param ho a HierarchyObject with constant isAlphab.
+ * 	@param oneLoopFlagIn an integer flag which is 0 or 1 in order to add or omit the expanded one-loop results to the returned value, respectivley.
+ * 	@param twoLoopFlagIn an integer flag which is 0 or 1 in order to add or omit the expanded two-loop results to the returned value, respectivley.
+ * 	@param threeLoopFlagIn an integer flag which is 0 or 1 in order to add or omit the expanded three-loop results to the returned value, respectivley.
+ * 	@param flags the expansion depth of each expansion variable.
+ * 	@param truncations if not null, this vector is filled with the mass matrices of the terms which are omitted when
+ * 	truncating the expansion in one of the expansion variables of the hierarchy one order lower.
+ * 	@throws runtime_error Throws a runtime_error if the tree-level is requested in terms of hierarchies.
+ * 	@return The loop corrected Higgs mass matrix which contains the expanded corrections at the given order.
+ */
+Eigen::Matrix2d himalaya::HierarchyCalculator::calculateHierarchy(himalaya::HierarchyObject& ho, const int oneLoopFlagIn,
+								  const int twoLoopFlagIn, const int threeLoopFlagIn,
+								  const ExpansionFlags& flags,
+								  std::vector<Eigen::Matrix2d>* truncations) const {
+   if (truncations) {
+      truncations->clear();
+   }
+
    // get the hierarchy
    const int hierarchy = ho.getSuitableHierarchy();
 
    // the hierarchy files containing 1-, 2- and 3-loop terms (alpha_s^0 alpha_t/b, alpha_s alpha_t/b, alpha_s^2 alpha_t/b)
    double sigS1Full = 0., sigS2Full = 0., sigS12Full = 0.;
 
-   // common variables
-   double At, Mt, s2t, Mst1 = 0., Mst2 = 0.;
-   if (!ho.getIsAlphab()) {
-      At = p.Au(2,2);
-      Mt = p.Mt;
-      s2t = p.s2t;
-   }
-   else {
-      At = p.Ad(2,2);
-      Mt = p.Mb;
-      s2t = p.s2b;
-   }
-
-   const double beta = atan(p.vu / p.vd);
-   const double lmMt = log(pow2(p.scale / Mt));
+   // the masses and logarithms of the point, where the stop/sbottom masses are shifted at each loop order
+   Kinematics<double> k = kinematics[ho.getIsAlphab()];
+   double Mst1 = 0., Mst2 = 0.;
 
    // this loop is needed to calculate the suitable mass shift order by order
    for(int currentLoopOrder = 1; currentLoopOrder <= 3; currentLoopOrder ++){
@@ -509,68 +1414,38 @@ Eigen::Matrix2d himalaya::HierarchyCalculator::calculateHierarchy(himalaya::Hier
 	 else{
 	    throw std::runtime_error("There are no tree-level hierarchies included!");
 	 }
+	 k.setStopMasses(Mst1, Mst2);
 	 // select the suitable hierarchy for the specific hierarchy and set variables
 	 switch(getCorrectHierarchy(hierarchy)){
 	    case Hierarchies::h3:{
-	       const double Dmglst1 = Mgl - Mst1;
-	       const double Dmsqst1 = pow2(Msq) - pow2(Mst1);
-	       const double Dmst12 = pow2(Mst1) - pow2(Mst2);
-	       const double lmMst1 = log(pow2(p.scale / Mst1));
 	       switch(hierarchy){
 		  case Hierarchies::h3:{
-		     const H3 hierarchy3(flagMap, Al4p, beta,
-			Dmglst1, Dmst12, Dmsqst1, lmMt, lmMst1,
-			Mgl, Mt, Mst1, Mst2, Msq, p.mu,
-			s2t, 
-			ho.getMDRFlag(), oneLoopFlag, twoLoopFlag, threeLoopFlag);
-		     curSig1 = hierarchy3.getS1();
-		     curSig2 = hierarchy3.getS2();
-		     curSig12 = hierarchy3.getS12();
+		     const H3<double> hierarchy3(flags, k, ho.getMDRFlag());
+		     calcSigmasAtLoopOrder(hierarchy3, currentLoopOrder, curSig1, curSig2, curSig12, truncations);
 		     if(oneLoopFlagIn == 0 && twoLoopFlagIn == 0 && threeLoopFlagIn == 1){
-                        const double c = hierarchy3.calc_coef_at_as2_no_sm_logs_log0();
-			ho.setDLambdaH3m(c
-			   + lmMst1 * hierarchy3.calc_coef_at_as2_no_sm_logs_log1()
-			   + pow2(lmMst1) * hierarchy3.calc_coef_at_as2_no_sm_logs_log2()
-			   + pow3(lmMst1) * hierarchy3.calc_coef_at_as2_no_sm_logs_log3());
-                        ho.setDLambdaNonLog(c);
+                        const auto c = hierarchy3.calc_coefs_at_as2_no_sm_logs();
+			ho.setDLambdaH3m(c.eval(k.lmMst1));
+                        ho.setDLambdaNonLog(c.log0);
 		     }
 		  }
 		  break;
 		  case Hierarchies::h32q2g:{
-		     const H32q2g hierarchy32q2g(flagMap, Al4p, beta,
-			Dmglst1, Dmst12, Dmsqst1, lmMt, lmMst1,
-			Mt, Mst1, Mst2, p.mu,
-			s2t,
-			ho.getMDRFlag(), oneLoopFlag, twoLoopFlag, threeLoopFlag);
-		     curSig1 = hierarchy32q2g.getS1();
-		     curSig2 = hierarchy32q2g.getS2();
-		     curSig12 = hierarchy32q2g.getS12();
+		     const H32q2g<double> hierarchy32q2g(flags, k, ho.getMDRFlag());
+		     calcSigmasAtLoopOrder(hierarchy32q2g, currentLoopOrder, curSig1, curSig2, curSig12, truncations);
 		     if(oneLoopFlagIn == 0 && twoLoopFlagIn == 0 && threeLoopFlagIn == 1){
-                        const double c = hierarchy32q2g.calc_coef_at_as2_no_sm_logs_log0();
-			ho.setDLambdaH3m(c
-			   + lmMst1 * hierarchy32q2g.calc_coef_at_as2_no_sm_logs_log1()
-			   + pow2(lmMst1) * hierarchy32q2g.calc_coef_at_as2_no_sm_logs_log2()
-			   + pow3(lmMst1) * hierarchy32q2g.calc_coef_at_as2_no_sm_logs_log3());
-                        ho.setDLambdaNonLog(c);
+                        const auto c = hierarchy32q2g.calc_coefs_at_as2_no_sm_logs();
+			ho.setDLambdaH3m(c.eval(k.lmMst1));
+                        ho.setDLambdaNonLog(c.log0);
 		     }
 		  }
 		  break;
 		  case Hierarchies::h3q22g:{
-		     const H3q22g hierarchy3q22g(flagMap, Al4p, beta,
-			Dmglst1, Dmst12, Dmsqst1, lmMt, lmMst1,
-			Mt, Mst1, Mst2, Msq, p.mu,
-			s2t,
-			ho.getMDRFlag(), oneLoopFlag, twoLoopFlag, threeLoopFlag);
-		     curSig1 = hierarchy3q22g.getS1();
-		     curSig2 = hierarchy3q22g.getS2();
-		     curSig12 = hierarchy3q22g.getS12();
+		     const H3q22g<double> hierarchy3q22g(flags, k, ho.getMDRFlag());
+		     calcSigmasAtLoopOrder(hierarchy3q22g, currentLoopOrder, curSig1, curSig2, curSig12, truncations);
 		     if(oneLoopFlagIn == 0 && twoLoopFlagIn == 0 && threeLoopFlagIn == 1){
-                        const double c = hierarchy3q22g.calc_coef_at_as2_no_sm_logs_log0();
-			ho.setDLambdaH3m(c
-			   + lmMst1 * hierarchy3q22g.calc_coef_at_as2_no_sm_logs_log1()
-			   + pow2(lmMst1) * hierarchy3q22g.calc_coef_at_as2_no_sm_logs_log2()
-			   + pow3(lmMst1) * hierarchy3q22g.calc_coef_at_as2_no_sm_logs_log3());
-                        ho.setDLambdaNonLog(c);
+                        const auto c = hierarchy3q22g.calc_coefs_at_as2_no_sm_logs();
+			ho.setDLambdaH3m(c.eval(k.lmMst1));
+                        ho.setDLambdaNonLog(c.log0);
 		     }
 		  }
 		  break;
@@ -578,65 +1453,34 @@ Eigen::Matrix2d himalaya::HierarchyCalculator::calculateHierarchy(himalaya::Hier
 	    }
 	    break;
 	    case Hierarchies::h4:{
-	       const double Msusy = (Mst1 + Mst2 + Mgl) / 3.;
-	       const double lmMsusy = log(pow2(p.scale / Msusy));
-	       const double lmMst1 = log(pow2(p.scale / Mst1));
-	       const H4 hierarchy4(flagMap, Al4p, At, beta,
-		  lmMt, lmMsq, lmMsusy, Mt, Msusy, Msq,
-		  ho.getMDRFlag(), oneLoopFlag, twoLoopFlag, threeLoopFlag);
-	       curSig1 = hierarchy4.getS1();
-	       curSig2 = hierarchy4.getS2();
-	       curSig12 = hierarchy4.getS12();
+	       const H4<double> hierarchy4(flags, k, ho.getMDRFlag());
+	       calcSigmasAtLoopOrder(hierarchy4, currentLoopOrder, curSig1, curSig2, curSig12, truncations);
 	       if(oneLoopFlagIn == 0 && twoLoopFlagIn == 0 && threeLoopFlagIn == 1){
-                  const double c = hierarchy4.calc_coef_at_as2_no_sm_logs_log0();
-		  ho.setDLambdaH3m(c
-		     + lmMst1 * hierarchy4.calc_coef_at_as2_no_sm_logs_log1()
-		     + pow2(lmMst1) * hierarchy4.calc_coef_at_as2_no_sm_logs_log2()
-		     + pow3(lmMst1) * hierarchy4.calc_coef_at_as2_no_sm_logs_log3());
-                  ho.setDLambdaNonLog(c);
+                  const auto c = hierarchy4.calc_coefs_at_as2_no_sm_logs();
+		  ho.setDLambdaH3m(c.eval(k.lmMst1));
+                  ho.setDLambdaNonLog(c.log0);
 	       }
 	    }
 	    break;
 	    case Hierarchies::h5:{
-	       const double Dmglst1 = Mgl - Mst1;
-	       const double lmMst1 = log(pow2(p.scale / Mst1));
-	       const double lmMst2 = log(pow2(p.scale / Mst2));
 	       switch(hierarchy){
 		  case Hierarchies::h5:{
-		     const H5 hierarchy5(flagMap, Al4p, beta, Dmglst1,
-			lmMt, lmMst1, lmMst2, lmMsq, Mt, Mst1,
-			Mst2, Msq, p.mu,
-			s2t,
-			ho.getMDRFlag(), oneLoopFlag, twoLoopFlag, threeLoopFlag);
-		     curSig1 = hierarchy5.getS1();
-		     curSig2 = hierarchy5.getS2();
-		     curSig12 = hierarchy5.getS12();
+		     const H5<double> hierarchy5(flags, k, ho.getMDRFlag());
+		     calcSigmasAtLoopOrder(hierarchy5, currentLoopOrder, curSig1, curSig2, curSig12, truncations);
 		     if(oneLoopFlagIn == 0 && twoLoopFlagIn == 0 && threeLoopFlagIn == 1){
-                        const double c = hierarchy5.calc_coef_at_as2_no_sm_logs_log0();
-			ho.setDLambdaH3m(c
-			   + lmMst1 * hierarchy5.calc_coef_at_as2_no_sm_logs_log1()
-			   + pow2(lmMst1) * hierarchy5.calc_coef_at_as2_no_sm_logs_log2()
-			   + pow3(lmMst1) * hierarchy5.calc_coef_at_as2_no_sm_logs_log3());
-                        ho.setDLambdaNonLog(c);
+                        const auto c = hierarchy5.calc_coefs_at_as2_no_sm_logs();
+			ho.setDLambdaH3m(c.eval(k.lmMst1));
+                        ho.setDLambdaNonLog(c.log0);
 		     }
 		  }
 		  break;
 		  case Hierarchies::h5g1:{
-		     const H5g1 hierarchy5g1(flagMap, Al4p, beta, Dmglst1,
-			lmMt, lmMst1, lmMst2, lmMsq, Mgl, Mt, Mst1,
-			Mst2, Msq, p.mu,
-			s2t,
-			ho.getMDRFlag(), oneLoopFlag, twoLoopFlag, threeLoopFlag);
-		     curSig1 = hierarchy5g1.getS1();
-		     curSig2 = hierarchy5g1.getS2();
-		     curSig12 = hierarchy5g1.getS12();
+		     const H5g1<double> hierarchy5g1(flags, k, ho.getMDRFlag());
+		     calcSigmasAtLoopOrder(hierarchy5g1, currentLoopOrder, curSig1, curSig2, curSig12, truncations);
 		     if(oneLoopFlagIn == 0 && twoLoopFlagIn == 0 && threeLoopFlagIn == 1){
-                        const double c = hierarchy5g1.calc_coef_at_as2_no_sm_logs_log0();
-			ho.setDLambdaH3m(c
-			   + lmMst1 * hierarchy5g1.calc_coef_at_as2_no_sm_logs_log1()
-			   + pow2(lmMst1) * hierarchy5g1.calc_coef_at_as2_no_sm_logs_log2()
-			   + pow3(lmMst1) * hierarchy5g1.calc_coef_at_as2_no_sm_logs_log3());
-                        ho.setDLambdaNonLog(c);
+                        const auto c = hierarchy5g1.calc_coefs_at_as2_no_sm_logs();
+			ho.setDLambdaH3m(c.eval(k.lmMst1));
+                        ho.setDLambdaNonLog(c.log0);
 		     }
 		  }
 		  break;
@@ -644,45 +1488,24 @@ Eigen::Matrix2d himalaya::HierarchyCalculator::calculateHierarchy(himalaya::Hier
 	    }
 	    break;
 	    case Hierarchies::h6:{
-	       const double Dmglst2 = Mgl - Mst2;
-	       const double lmMst1 = log(pow2(p.scale / Mst1));
-	       const double lmMst2 = log(pow2(p.scale / Mst2));
 	       switch(hierarchy){
 		  case Hierarchies::h6:{
-		     const H6 hierarchy6(flagMap, Al4p, beta, Dmglst2,
-			lmMt, lmMst1, lmMst2, lmMsq,
-			Mt, Mst1, Mst2, Msq, p.mu,
-			s2t,
-			ho.getMDRFlag(), oneLoopFlag, twoLoopFlag, threeLoopFlag);
-		     curSig1 = hierarchy6.getS1();
-		     curSig2 = hierarchy6.getS2();
-		     curSig12 = hierarchy6.getS12();
+		     const H6<double> hierarchy6(flags, k, ho.getMDRFlag());
+		     calcSigmasAtLoopOrder(hierarchy6, currentLoopOrder, curSig1, curSig2, curSig12, truncations);
 		     if(oneLoopFlagIn == 0 && twoLoopFlagIn == 0 && threeLoopFlagIn == 1){
-                        const double c = hierarchy6.calc_coef_at_as2_no_sm_logs_log0();
-			ho.setDLambdaH3m(c
-			   + lmMst1 * hierarchy6.calc_coef_at_as2_no_sm_logs_log1()
-			   + pow2(lmMst1) * hierarchy6.calc_coef_at_as2_no_sm_logs_log2()
-			   + pow3(lmMst1) * hierarchy6.calc_coef_at_as2_no_sm_logs_log3());
-                        ho.setDLambdaNonLog(c);
+                        const auto c = hierarchy6.calc_coefs_at_as2_no_sm_logs();
+			ho.setDLambdaH3m(c.eval(k.lmMst1));
+                        ho.setDLambdaNonLog(c.log0);
 		     };
 		  }
 		  break;
 		  case Hierarchies::h6g2:{
-		     const H6g2 hierarchy6g2(flagMap, Al4p, beta, Dmglst2,
-			lmMt, lmMst1, lmMst2, lmMsq,
-			Mgl, Mt, Mst1, Mst2, Msq, p.mu,
-			s2t,
-			ho.getMDRFlag(), oneLoopFlag, twoLoopFlag, threeLoopFlag);
-		     curSig1 = hierarchy6g2.getS1();
-		     curSig2 = hierarchy6g2.getS2();
-		     curSig12 = hierarchy6g2.getS12();
+		     const H6g2<double> hierarchy6g2(flags, k, ho.getMDRFlag());
+		     calcSigmasAtLoopOrder(hierarchy6g2, currentLoopOrder, curSig1, curSig2, curSig12, truncations);
 		     if(oneLoopFlagIn == 0 && twoLoopFlagIn == 0 && threeLoopFlagIn == 1){
-                        const double c = hierarchy6g2.calc_coef_at_as2_no_sm_logs_log0();
-			ho.setDLambdaH3m(c
-			   + lmMst1 * hierarchy6g2.calc_coef_at_as2_no_sm_logs_log1()
-			   + pow2(lmMst1) * hierarchy6g2.calc_coef_at_as2_no_sm_logs_log2()
-			   + pow3(lmMst1) * hierarchy6g2.calc_coef_at_as2_no_sm_logs_log3());
-                        ho.setDLambdaNonLog(c);
+                        const auto c = hierarchy6g2.calc_coefs_at_as2_no_sm_logs();
+			ho.setDLambdaH3m(c.eval(k.lmMst1));
+                        ho.setDLambdaNonLog(c.log0);
 		     }
 		  }
 		  break;
@@ -690,84 +1513,44 @@ Eigen::Matrix2d himalaya::HierarchyCalculator::calculateHierarchy(himalaya::Hier
 	    }
 	    break;
 	    case Hierarchies::h6b:{
-	       const double Dmglst2 = Mgl - Mst2;
-	       const double Dmsqst2 = Msq - Mst2;
-	       const double lmMst1 = log(pow2(p.scale / Mst1));
-	       const double lmMst2 = log(pow2(p.scale / Mst2));
 	       switch(hierarchy){
 		  case Hierarchies::h6b:{
-		     const H6b hierarchy6b(flagMap, Al4p, beta, Dmglst2,
-			Dmsqst2, lmMt, lmMst1, lmMst2,
-			Mt, Mst1, Mst2, p.mu,
-			s2t,
-			ho.getMDRFlag(), oneLoopFlag, twoLoopFlag, threeLoopFlag);
-		     curSig1 = hierarchy6b.getS1();
-		     curSig2 = hierarchy6b.getS2();
-		     curSig12 = hierarchy6b.getS12();
+		     const H6b<double> hierarchy6b(flags, k, ho.getMDRFlag());
+		     calcSigmasAtLoopOrder(hierarchy6b, currentLoopOrder, curSig1, curSig2, curSig12, truncations);
 		     if(oneLoopFlagIn == 0 && twoLoopFlagIn == 0 && threeLoopFlagIn == 1){
-                        const double c = hierarchy6b.calc_coef_at_as2_no_sm_logs_log0();
-			ho.setDLambdaH3m(c
-			   + lmMst1 * hierarchy6b.calc_coef_at_as2_no_sm_logs_log1()
-			   + pow2(lmMst1) * hierarchy6b.calc_coef_at_as2_no_sm_logs_log2()
-			   + pow3(lmMst1) * hierarchy6b.calc_coef_at_as2_no_sm_logs_log3());
-                        ho.setDLambdaNonLog(c);
+                        const auto c = hierarchy6b.calc_coefs_at_as2_no_sm_logs();
+			ho.setDLambdaH3m(c.eval(k.lmMst1));
+                        ho.setDLambdaNonLog(c.log0);
 		     }
 		  }
 		  break;
 		  case Hierarchies::h6b2qg2:{
-		     const H6b2qg2 hierarchy6b2qg2(flagMap, Al4p, beta, Dmglst2,
-			Dmsqst2, lmMt, lmMst1, lmMst2,
-			Mgl, Mt, Mst1, Mst2, p.mu,
-			s2t,
-			ho.getMDRFlag(), oneLoopFlag, twoLoopFlag, threeLoopFlag);
-		     curSig1 = hierarchy6b2qg2.getS1();
-		     curSig2 = hierarchy6b2qg2.getS2();
-		     curSig12 = hierarchy6b2qg2.getS12();
+		     const H6b2qg2<double> hierarchy6b2qg2(flags, k, ho.getMDRFlag());
+		     calcSigmasAtLoopOrder(hierarchy6b2qg2, currentLoopOrder, curSig1, curSig2, curSig12, truncations);
 		     if(oneLoopFlagIn == 0 && twoLoopFlagIn == 0 && threeLoopFlagIn == 1){
-                        const double c = hierarchy6b2qg2.calc_coef_at_as2_no_sm_logs_log0();
-			ho.setDLambdaH3m(c
-			   + lmMst1 * hierarchy6b2qg2.calc_coef_at_as2_no_sm_logs_log1()
-			   + pow2(lmMst1) * hierarchy6b2qg2.calc_coef_at_as2_no_sm_logs_log2()
-			   + pow3(lmMst1) * hierarchy6b2qg2.calc_coef_at_as2_no_sm_logs_log3());
-                        ho.setDLambdaNonLog(c);
+                        const auto c = hierarchy6b2qg2.calc_coefs_at_as2_no_sm_logs();
+			ho.setDLambdaH3m(c.eval(k.lmMst1));
+                        ho.setDLambdaNonLog(c.log0);
 		     }
 		  }
 		  break;
 		  case Hierarchies::h6bq22g:{
-		     const H6bq22g hierarchy6bq22g(flagMap, Al4p, beta, Dmglst2,
-			Dmsqst2, lmMt, lmMst1, lmMst2,
-			Mt, Mst1, Mst2, Msq, p.mu,
-			s2t,
-			ho.getMDRFlag(), oneLoopFlag, twoLoopFlag, threeLoopFlag);
-		     curSig1 = hierarchy6bq22g.getS1();
-		     curSig2 = hierarchy6bq22g.getS2();
-		     curSig12 = hierarchy6bq22g.getS12();
+		     const H6bq22g<double> hierarchy6bq22g(flags, k, ho.getMDRFlag());
+		     calcSigmasAtLoopOrder(hierarchy6bq22g, currentLoopOrder, curSig1, curSig2, curSig12, truncations);
 		     if(oneLoopFlagIn == 0 && twoLoopFlagIn == 0 && threeLoopFlagIn == 1){
-                        const double c = hierarchy6bq22g.calc_coef_at_as2_no_sm_logs_log0();
-			ho.setDLambdaH3m(c
-			   + lmMst1 * hierarchy6bq22g.calc_coef_at_as2_no_sm_logs_log1()
-			   + pow2(lmMst1) * hierarchy6bq22g.calc_coef_at_as2_no_sm_logs_log2()
-			   + pow3(lmMst1) * hierarchy6bq22g.calc_coef_at_as2_no_sm_logs_log3());
-                        ho.setDLambdaNonLog(c);
+                        const auto c = hierarchy6bq22g.calc_coefs_at_as2_no_sm_logs();
+			ho.setDLambdaH3m(c.eval(k.lmMst1));
+                        ho.setDLambdaNonLog(c.log0);
 		     }
 		  }
 		  break;
 		  case Hierarchies::h6bq2g2:{
-		     const H6bq2g2 hierarchy6bq2g2(flagMap, Al4p, beta, Dmglst2,
-			Dmsqst2, lmMt, lmMst1, lmMst2,
-			Mgl, Mt, Mst1,Mst2, Msq, p.mu,
-			s2t,
-			ho.getMDRFlag(), oneLoopFlag, twoLoopFlag, threeLoopFlag);
-		     curSig1 = hierarchy6bq2g2.getS1();
-		     curSig2 = hierarchy6bq2g2.getS2();
-		     curSig12 = hierarchy6bq2g2.getS12();
+		     const H6bq2g2<double> hierarchy6bq2g2(flags, k, ho.getMDRFlag());
+		     calcSigmasAtLoopOrder(hierarchy6bq2g2, currentLoopOrder, curSig1, curSig2, curSig12, truncations);
 		     if(oneLoopFlagIn == 0 && twoLoopFlagIn == 0 && threeLoopFlagIn == 1){
-                        const double c = hierarchy6bq2g2.calc_coef_at_as2_no_sm_logs_log0();
-			ho.setDLambdaH3m(c
-			   + lmMst1 * hierarchy6bq2g2.calc_coef_at_as2_no_sm_logs_log1()
-			   + pow2(lmMst1) * hierarchy6bq2g2.calc_coef_at_as2_no_sm_logs_log2()
-			   + pow3(lmMst1) * hierarchy6bq2g2.calc_coef_at_as2_no_sm_logs_log3());
-                        ho.setDLambdaNonLog(c);
+                        const auto c = hierarchy6bq2g2.calc_coefs_at_as2_no_sm_logs();
+			ho.setDLambdaH3m(c.eval(k.lmMst1));
+                        ho.setDLambdaNonLog(c.log0);
 		     }
 		  }
 		  break;
@@ -775,45 +1558,24 @@ Eigen::Matrix2d himalaya::HierarchyCalculator::calculateHierarchy(himalaya::Hier
 	    }
 	    break;
 	    case Hierarchies::h9:{
-	       const double lmMst1 = log(pow2(p.scale / Mst1));
-	       const double Dmst12 = pow2(Mst1) - pow2(Mst2);
-	       const double Dmsqst1 = pow2(Msq) - pow2(Mst1);
 	       switch(hierarchy){
 		  case Hierarchies::h9:{
-		     const H9 hierarchy9(flagMap, Al4p, beta, Dmst12, Dmsqst1,
-			lmMt, lmMgl, lmMst1,
-			Mgl, Mt, Mst1, Mst2, p.mu,
-			s2t,
-			ho.getMDRFlag(), oneLoopFlag, twoLoopFlag, threeLoopFlag);
-		     curSig1 = hierarchy9.getS1();
-		     curSig2 = hierarchy9.getS2();
-		     curSig12 = hierarchy9.getS12();
+		     const H9<double> hierarchy9(flags, k, ho.getMDRFlag());
+		     calcSigmasAtLoopOrder(hierarchy9, currentLoopOrder, curSig1, curSig2, curSig12, truncations);
 		     if(oneLoopFlagIn == 0 && twoLoopFlagIn == 0 && threeLoopFlagIn == 1){
-                        const double c = hierarchy9.calc_coef_at_as2_no_sm_logs_log0();
-			ho.setDLambdaH3m(c
-			   + lmMst1 * hierarchy9.calc_coef_at_as2_no_sm_logs_log1()
-			   + pow2(lmMst1) * hierarchy9.calc_coef_at_as2_no_sm_logs_log2()
-			   + pow3(lmMst1) * hierarchy9.calc_coef_at_as2_no_sm_logs_log3());
-                        ho.setDLambdaNonLog(c);
+                        const auto c = hierarchy9.calc_coefs_at_as2_no_sm_logs();
+			ho.setDLambdaH3m(c.eval(k.lmMst1));
+                        ho.setDLambdaNonLog(c.log0);
 		     }
 		  }
 		  break;
 		  case Hierarchies::h9q2:{
-		     const H9q2 hierarchy9q2(flagMap, Al4p, beta, Dmst12, Dmsqst1,
-			lmMt, lmMgl, lmMst1,
-			Mgl, Mt, Mst1, Mst2, Msq, p.mu,
-			s2t,
-			ho.getMDRFlag(), oneLoopFlag, twoLoopFlag, threeLoopFlag);
-		     curSig1 = hierarchy9q2.getS1();
-		     curSig2 = hierarchy9q2.getS2();
-		     curSig12 = hierarchy9q2.getS12();
+		     const H9q2<double> hierarchy9q2(flags, k, ho.getMDRFlag());
+		     calcSigmasAtLoopOrder(hierarchy9q2, currentLoopOrder, curSig1, curSig2, curSig12, truncations);
 		     if(oneLoopFlagIn == 0 && twoLoopFlagIn == 0 && threeLoopFlagIn == 1){
-                        const double c = hierarchy9q2.calc_coef_at_as2_no_sm_logs_log0();
-			ho.setDLambdaH3m(c
-			   + lmMst1 * hierarchy9q2.calc_coef_at_as2_no_sm_logs_log1()
-			   + pow2(lmMst1) * hierarchy9q2.calc_coef_at_as2_no_sm_logs_log2()
-			   + pow3(lmMst1) * hierarchy9q2.calc_coef_at_as2_no_sm_logs_log3());
-                        ho.setDLambdaNonLog(c);
+                        const auto c = hierarchy9q2.calc_coefs_at_as2_no_sm_logs();
+			ho.setDLambdaH3m(c.eval(k.lmMst1));
+                        ho.setDLambdaNonLog(c.log0);
 		     }
 		  }
 		  break;
@@ -840,6 +1602,13 @@ Eigen::Matrix2d himalaya::HierarchyCalculator::calculateHierarchy(himalaya::Hier
    higgsMassMatrix(0, 1) = prefac * sigS12Full;
    higgsMassMatrix(1, 0) = higgsMassMatrix(0, 1);
    higgsMassMatrix(1, 1) = prefac * sigS2Full;
+
+   if (truncations) {
+      for (auto& truncation: *truncations) {
+         truncation *= prefac;
+      }
+   }
+
    return higgsMassMatrix;
 }
 
@@ -852,18 +1621,10 @@ Eigen::Matrix2d himalaya::HierarchyCalculator::calculateHierarchy(himalaya::Hier
  */
 double himalaya::HierarchyCalculator::shiftMst1ToMDR(const himalaya::HierarchyObject& ho,
 						     const unsigned int oneLoopFlag,
-						     const unsigned int twoLoopFlag) {
-   double Mst1mod = 0., Mst1, Mst2;
-   if(!ho.getIsAlphab()){
-      Mst1 = p.MSt(0);
-      Mst2 = p.MSt(1);
-   }
-   else{
-      Mst1 = p.MSb(0);
-      Mst2 = p.MSb(1);
-   }
-   const double lmMst2 = log(pow2(p.scale) / pow2(Mst2));
-   const double Dmglst2 = Mgl - Mst2;
+						     const unsigned int twoLoopFlag) const {
+   const Kinematics<double>& k = kinematics[ho.getIsAlphab()];
+   const double Mst1 = k.Mst1, Mst2 = k.Mst2, lmMst2 = k.lmMst2, Dmglst2 = k.Dmglst2;
+   double Mst1mod = 0.;
    const double mdr2mst1ka = (-8. * twoLoopFlag * pow2(Al4p)
       * (10 * pow2(Msq) * (-1 + 2 * lmMsq + 2 * z2) + pow2(Mst2)
       * (-1 + 2 * lmMst2 + 2 * z2))) / (3. * pow2(Mst1));
@@ -905,15 +1666,10 @@ double himalaya::HierarchyCalculator::shiftMst1ToMDR(const himalaya::HierarchyOb
  */
 double himalaya::HierarchyCalculator::shiftMst2ToMDR(const himalaya::HierarchyObject& ho,
 						     const unsigned int oneLoopFlag,
-						     const unsigned int twoLoopFlag) {
-   double Mst2mod = 0., Mst2;
-   if(!ho.getIsAlphab()){
-      Mst2 = p.MSt(1);
-   }
-   else{
-      Mst2 = p.MSb(1);
-   }
-   const double Dmglst2 = Mgl - Mst2;
+						     const unsigned int twoLoopFlag) const {
+   const Kinematics<double>& k = kinematics[ho.getIsAlphab()];
+   const double Mst2 = k.Mst2, Dmglst2 = k.Dmglst2;
+   double Mst2mod = 0.;
    const double mdr2mst2ka = (-80. * twoLoopFlag * pow2(Al4p) 
       * pow2(Msq) * (-1 + 2 * lmMsq + 2 * z2)) / (3. * pow2(Mst2));
    switch (getCorrectHierarchy(ho.getSuitableHierarchy())) {
@@ -951,7 +1707,7 @@ double himalaya::HierarchyCalculator::shiftMst2ToMDR(const himalaya::HierarchyOb
  * 	@return A matrix which shifts the H3m scheme to the DR' scheme at three-loop level
  *
  */
-Eigen::Matrix2d himalaya::HierarchyCalculator::shiftH3mToDRbarPrime(const himalaya::HierarchyObject& ho){
+Eigen::Matrix2d himalaya::HierarchyCalculator::shiftH3mToDRbarPrime(const himalaya::HierarchyObject& ho) const{
    Eigen::Matrix2d shift;
    
    // truncate shift at O(Xt^2) to be consistent with H3m result
@@ -1068,7 +1824,7 @@ Eigen::Matrix2d himalaya::HierarchyCalculator::shiftH3mToDRbarPrime(const himala
  * 	@return A double which shifts the H3m scheme to the DR' scheme at three-loop level
  *
  */
-double himalaya::HierarchyCalculator::shiftH3mToDRbarPrimeMh2(const himalaya::HierarchyObject& ho, int omitLogs){
+double himalaya::HierarchyCalculator::shiftH3mToDRbarPrimeMh2(const himalaya::HierarchyObject& ho, int omitLogs) const{
    double shift;
    
    // truncate shift at O(Xt^2) to be consistent with H3m result
@@ -1158,90 +1914,98 @@ double himalaya::HierarchyCalculator::shiftH3mToDRbarPrimeMh2(const himalaya::Hi
 
 
 /**
- * 	Sorts the eigenvalues of a 2x2 matrix.
- * 	@param es the EigenSolver object corresponding to the matrix whose eigenvalues should be sorted.
- * 	@return A sorted vector with the lowest eigenvalue at position 0.
+ * 	Calculates the loop corrected Higgs mass matrix at the order O(alpha_x). Here, x can be t or b.
+ * 	@param ho a HierarchyObject with constant isAlphab.
+ * 	@param shiftOneLoop An integer flag which is 0 or 1 in order to shift the one-loop terms to the MDR scheme.
+ * 	@param shiftTwoLoop An integer flag which is 0 or 1 in order to shift the two-loop terms to the MDR scheme.
+ * 	@return The loop corrected Higgs mass matrix at the order O(alpha_x).
  */
-std::vector<double> himalaya::HierarchyCalculator::sortEigenvalues(const Eigen::EigenSolver<Eigen::Matrix2d>& es){
-  std::vector<double> sortedEigenvalues = {sqrt(std::real(es.eigenvalues()(0))), sqrt(std::real(es.eigenvalues()(1)))};
-  std::sort(sortedEigenvalues.begin(), sortedEigenvalues.end());
-  return sortedEigenvalues;
+Eigen::Matrix2d himalaya::HierarchyCalculator::getMt41L(const himalaya::HierarchyObject& ho, const unsigned int shiftOneLoop, const unsigned int shiftTwoLoop) const{
+   ExactMassMatrixCache cache;
+   return getMt41L(ho, shiftOneLoop, shiftTwoLoop, cache);
 }
 
 /**
- * 	Calculates the loop corrected Higgs mass matrix at the order O(alpha_x). Here, x can be t or b.
+ * 	Calculates the loop corrected Higgs mass matrix at the order O(alpha_x) using the memoized results of the current calculation.
  * 	@param ho a HierarchyObject with constant isAlphab.
  * 	@param shiftOneLoop An integer flag which is 0 or 1 in order to shift the one-loop terms to the MDR scheme.
  * 	@param shiftTwoLoop An integer flag which is 0 or 1 in order to shift the two-loop terms to the MDR scheme.
+ * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
  * 	@return The loop corrected Higgs mass matrix at the order O(alpha_x).
  */
-Eigen::Matrix2d himalaya::HierarchyCalculator::getMt41L(const himalaya::HierarchyObject& ho, const unsigned int shiftOneLoop, const unsigned int shiftTwoLoop){
-   Eigen::Matrix2d Mt41L;
-   const double GF = 1/(sqrt(2) * (pow2(p.vu) + pow2(p.vd)));
-   const double beta = atan(p.vu/p.vd);
+Eigen::Matrix2d himalaya::HierarchyCalculator::getMt41L(const himalaya::HierarchyObject& ho,
+							const unsigned int shiftOneLoop,
+							const unsigned int shiftTwoLoop,
+							ExactMassMatrixCache& cache) const{
    const double Mst1 = shiftMst1ToMDR(ho, shiftOneLoop, shiftTwoLoop);
    const double Mst2 = shiftMst2ToMDR(ho, shiftOneLoop, shiftTwoLoop);
-   const double sbeta = sin(beta);
-   const double cbeta = cos(beta);
-   double Mt;
-   double s2t;
-   if(!ho.getIsAlphab()){
-      s2t = p.s2t;
-      Mt = p.Mt;
-   }
-   else{
-      s2t = p.s2b;
-      Mt = p.Mb;
-   }
+
+   // the result depends on the hierarchy and the scheme only through the stop/sbottom masses
+   const ExactMassMatrixKey key(ho.getIsAlphab(), Mst1, Mst2);
+   const auto cached = cache.Mt41L.find(key);
+   if (cached != cache.Mt41L.end())
+      return cached->second;
+
+   Eigen::Matrix2d Mt41L;
+   const Kinematics<double>& k = kinematics[ho.getIsAlphab()];
+   const double GF = 1/(sqrt(2) * (pow2(p.vu) + pow2(p.vd)));
+   const double sbeta = k.Sbeta;
+   const double cbeta = k.Cbeta;
+   const double Mt = k.Mt;
+   const double s2t = k.s2t;
+   const double logMst1 = log(Mst1);
+   const double logMst2 = log(Mst2);
    
    Mt41L(0, 0) = (-3 * GF * pow2(Mt) * pow2(p.mu) * pow2(1 / sbeta) *
-      (-pow2(Mst1) + pow2(Mst2) + pow2(Mst1) * log(Mst1) +
-      pow2(Mst2) * log(Mst1) - pow2(Mst1) * log(Mst2) -
-      pow2(Mst2) * log(Mst2)) * pow2(s2t)) /
+      (-pow2(Mst1) + pow2(Mst2) + pow2(Mst1) * logMst1 +
+      pow2(Mst2) * logMst1 - pow2(Mst1) * logMst2 -
+      pow2(Mst2) * logMst2) * pow2(s2t)) /
       (4. * sqrt(2) * (pow2(Mst1) - pow2(Mst2)) * pow2(Pi));
    
    Mt41L(0, 1) = (3 * GF * pow2(1 / sbeta) *
-      (-(pow3(Mt) * p.mu * (log(Mst1) - log(Mst2)) * s2t) / 2. +
-      (pow2(Mt) * pow2(p.mu) * 1 / tan(beta) *
-      (-pow2(Mst1) + pow2(Mst2) + pow2(Mst1) * log(Mst1) +
-      pow2(Mst2) * log(Mst1) - pow2(Mst1) * log(Mst2) -
-      pow2(Mst2) * log(Mst2)) * pow2(s2t)) /
+      (-(pow3(Mt) * p.mu * (logMst1 - logMst2) * s2t) / 2. +
+      (pow2(Mt) * pow2(p.mu) * 1 / k.Tbeta *
+      (-pow2(Mst1) + pow2(Mst2) + pow2(Mst1) * logMst1 +
+      pow2(Mst2) * logMst1 - pow2(Mst1) * logMst2 -
+      pow2(Mst2) * logMst2) * pow2(s2t)) /
       (4. * (pow2(Mst1) - pow2(Mst2))) +
-      (Mt * p.mu * (-pow2(Mst1) + pow2(Mst2) + pow2(Mst1) * log(Mst1) +
-      pow2(Mst2) * log(Mst1) - pow2(Mst1) * log(Mst2) -
-      pow2(Mst2) * log(Mst2)) * pow3(s2t)) / 8.)) /
+      (Mt * p.mu * (-pow2(Mst1) + pow2(Mst2) + pow2(Mst1) * logMst1 +
+      pow2(Mst2) * logMst1 - pow2(Mst1) * logMst2 -
+      pow2(Mst2) * logMst2) * pow3(s2t)) / 8.)) /
       (sqrt(2) * pow2(Pi));
    
    Mt41L (1,0) = Mt41L(0,1);
    
    Mt41L(1, 1) = (3 * GF * pow2(1 / sbeta) *
-      (pow4(Mt) * (log(Mst1) + log(Mst2) - 2 * log(Mt)) +
-      pow3(Mt) * p.mu * 1 / tan(beta) * (log(Mst1) - log(Mst2)) * s2t +
+      (pow4(Mt) * (logMst1 + logMst2 - 2 * log(Mt)) +
+      pow3(Mt) * p.mu * 1 / k.Tbeta * (logMst1 - logMst2) * s2t +
       (pow2(Mt) * pow2(1 / sbeta) *
       (pow2(Mst1) * pow2(p.mu) * pow2(cbeta) -
       pow2(Mst2) * pow2(p.mu) * pow2(cbeta) -
-      pow2(Mst1) * pow2(p.mu) * pow2(cbeta) * log(Mst1) -
-      pow2(Mst2) * pow2(p.mu) * pow2(cbeta) * log(Mst1) +
-      pow2(Mst1) * pow2(p.mu) * pow2(cbeta) * log(Mst2) +
-      pow2(Mst2) * pow2(p.mu) * pow2(cbeta) * log(Mst2) +
-      2 * pow4(Mst1) * log(Mst1) * pow2(sbeta) -
-      4 * pow2(Mst1) * pow2(Mst2) * log(Mst1) * pow2(sbeta) +
-      2 * pow4(Mst2) * log(Mst1) * pow2(sbeta) -
-      2 * pow4(Mst1) * log(Mst2) * pow2(sbeta) +
-      4 * pow2(Mst1) * pow2(Mst2) * log(Mst2) * pow2(sbeta) -
-      2 * pow4(Mst2) * log(Mst2) * pow2(sbeta)) * pow2(s2t)) /
+      pow2(Mst1) * pow2(p.mu) * pow2(cbeta) * logMst1 -
+      pow2(Mst2) * pow2(p.mu) * pow2(cbeta) * logMst1 +
+      pow2(Mst1) * pow2(p.mu) * pow2(cbeta) * logMst2 +
+      pow2(Mst2) * pow2(p.mu) * pow2(cbeta) * logMst2 +
+      2 * pow4(Mst1) * logMst1 * pow2(sbeta) -
+      4 * pow2(Mst1) * pow2(Mst2) * logMst1 * pow2(sbeta) +
+      2 * pow4(Mst2) * logMst1 * pow2(sbeta) -
+      2 * pow4(Mst1) * logMst2 * pow2(sbeta) +
+      4 * pow2(Mst1) * pow2(Mst2) * logMst2 * pow2(sbeta) -
+      2 * pow4(Mst2) * logMst2 * pow2(sbeta)) * pow2(s2t)) /
       (4. * (pow2(Mst1) - pow2(Mst2))) -
-      (Mt * p.mu * 1 / tan(beta) * (-pow2(Mst1) + pow2(Mst2) +
-      pow2(Mst1) * log(Mst1) + pow2(Mst2) * log(Mst1) -
-      pow2(Mst1) * log(Mst2) - pow2(Mst2) * log(Mst2)) *
+      (Mt * p.mu * 1 / k.Tbeta * (-pow2(Mst1) + pow2(Mst2) +
+      pow2(Mst1) * logMst1 + pow2(Mst2) * logMst1 -
+      pow2(Mst1) * logMst2 - pow2(Mst2) * logMst2) *
       pow3(s2t)) / 4. -
       ((pow2(Mst1) - pow2(Mst2)) *
-      (-pow2(Mst1) + pow2(Mst2) + pow2(Mst1) * log(Mst1) +
-      pow2(Mst2) * log(Mst1) - pow2(Mst1) * log(Mst2) -
-      pow2(Mst2) * log(Mst2)) * pow4(s2t)) / 16.)) /
+      (-pow2(Mst1) + pow2(Mst2) + pow2(Mst1) * logMst1 +
+      pow2(Mst2) * logMst1 - pow2(Mst1) * logMst2 -
+      pow2(Mst2) * logMst2) * pow4(s2t)) / 16.)) /
       (sqrt(2) * pow2(Pi));
-   
-    return Mt41L;
+
+   cache.Mt41L.emplace(key, Mt41L);
+
+   return Mt41L;
 }
 
 /**
@@ -1253,15 +2017,38 @@ Eigen::Matrix2d himalaya::HierarchyCalculator::getMt41L(const himalaya::Hierarch
  */
 Eigen::Matrix2d himalaya::HierarchyCalculator::getMt42L(const himalaya::HierarchyObject& ho,
 							const unsigned int shiftOneLoop,
-							const unsigned int shiftTwoLoop){
+							const unsigned int shiftTwoLoop) const{
+   ExactMassMatrixCache cache;
+   return getMt42L(ho, shiftOneLoop, shiftTwoLoop, cache);
+}
+
+/**
+ * 	Calculates the loop corrected Higgs mass matrix at the order O(alpha_x*alpha_s) using the memoized results of the current calculation.
+ * 	@param ho a HierarchyObject with constant isAlphab.
+ * 	@param shiftOneLoop An integer flag which is 0 or 1 in order to shift the one-loop terms to the MDR scheme.
+ * 	@param shiftTwoLoop An integer flag which is 0 or 1 in order to shift the two-loop terms to the MDR scheme.
+ * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+ * 	@return The loop corrected Higgs mass matrix at the order O(alpha_x*alpha_s).
+ */
+Eigen::Matrix2d himalaya::HierarchyCalculator::getMt42L(const himalaya::HierarchyObject& ho,
+							const unsigned int shiftOneLoop,
+							const unsigned int shiftTwoLoop,
+							ExactMassMatrixCache& cache) const{
+   const double Mst1 = shiftMst1ToMDR(ho, shiftOneLoop, shiftTwoLoop);
+   const double Mst2 = shiftMst2ToMDR(ho, shiftOneLoop, shiftTwoLoop);
+
+   // the result depends on the hierarchy and the scheme only through the stop/sbottom masses,
+   // so the call of dszhiggs is saved if these masses have been encountered before
+   const ExactMassMatrixKey key(ho.getIsAlphab(), Mst1, Mst2);
+   const auto cached = cache.Mt42L.find(key);
+   if (cached != cache.Mt42L.end())
+      return cached->second;
+
    Eigen::Matrix2d Mt42L;
    double S11, S12, S22;
    double Mt2;
-   double MG = p.MG;
    double st;
    double ct;
-   double Mst12 = pow2(shiftMst1ToMDR(ho, shiftOneLoop, shiftTwoLoop));
-   double Mst22 = pow2(shiftMst2ToMDR(ho, shiftOneLoop, shiftTwoLoop));
    if(!ho.getIsAlphab()){
       const double theta = asin(p.s2t)/2.;
       Mt2 = pow2(p.Mt);
@@ -1274,18 +2061,19 @@ Eigen::Matrix2d himalaya::HierarchyCalculator::getMt42L(const himalaya::Hierarch
       st = sin(theta);
       ct = cos(theta);
    }
-   double scale2 = pow2(p.scale);
    // note the sign difference in mu
-   double mu = - p.mu;
-   double tanb = p.vu/p.vd;
-   double v2 = pow2(p.vu) + pow2(p.vd);
-   double gs = p.g3;
-   int os = 0;
-   dszhiggs_(&Mt2, &MG, &Mst12, &Mst22, &st, &ct, &scale2, &mu, &tanb, &v2, &gs, &os, &S11, &S22, &S12);
+   const double mu = - p.mu;
+   const double tanb = p.vu/p.vd;
+   const double v2 = pow2(p.vu) + pow2(p.vd);
+   const int os = 0;
+   mh2l::dszhiggs(Mt2, p.MG, pow2(Mst1), pow2(Mst2), st, ct, pow2(p.scale), mu, tanb, v2, p.g3, os, S11, S22, S12);
    Mt42L(0, 0) = S11;
    Mt42L(1, 0) = S12;
    Mt42L(0, 1) = S12;
    Mt42L(1, 1) = S22;
+
+   cache.Mt42L.emplace(key, Mt42L);
+
    return Mt42L;
 }
 
@@ -1299,15 +2087,31 @@ Eigen::Matrix2d himalaya::HierarchyCalculator::getMt42L(const himalaya::Hierarch
  */
 Eigen::Matrix2d himalaya::HierarchyCalculator::calcDRbarToMDRbarShift(const himalaya::HierarchyObject& ho,
 								      const bool shiftOneLoop,
-								      const bool shiftTwoLoop){
+								      const bool shiftTwoLoop) const{
+   ExactMassMatrixCache cache;
+   return calcDRbarToMDRbarShift(ho, shiftOneLoop, shiftTwoLoop, cache);
+}
+
+/**
+ * 	Calculates the difference of the Higgs mass matrices of the MDR and DR scheme using the memoized results of the current calculation.
+ * 	@param ho a HierarchyObject with constant isAlphab.
+ * 	@param shiftOneLoop a bool to shift the terms at one-loop level.
+ * 	@param shiftTwoLoop a bool to shift the terms at two-loop level.
+ * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+ * 	@return The loop corrected Higgs mass matrix difference of the MDR and DR scheme at the given order.
+ */
+Eigen::Matrix2d himalaya::HierarchyCalculator::calcDRbarToMDRbarShift(const himalaya::HierarchyObject& ho,
+								      const bool shiftOneLoop,
+								      const bool shiftTwoLoop,
+								      ExactMassMatrixCache& cache) const{
    if(shiftOneLoop && shiftTwoLoop){
-      return getMt41L(ho, 1, 1) + getMt42L(ho, 1, 1) - getMt41L(ho, 0, 0) - getMt42L(ho, 0, 0);
+      return getMt41L(ho, 1, 1, cache) + getMt42L(ho, 1, 1, cache) - getMt41L(ho, 0, 0, cache) - getMt42L(ho, 0, 0, cache);
    }
    else if(shiftOneLoop){
-      return getMt41L(ho, 1, 1) - getMt41L(ho, 0, 0);
+      return getMt41L(ho, 1, 1, cache) - getMt41L(ho, 0, 0, cache);
    }
    else if(shiftTwoLoop){
-      return getMt42L(ho, 1, 1) - getMt42L(ho, 0, 0);
+      return getMt42L(ho, 1, 1, cache) - getMt42L(ho, 0, 0, cache);
    }
    else{
       return Eigen::Matrix2d::Zero();
@@ -1328,129 +2132,56 @@ double himalaya::HierarchyCalculator::getExpansionUncertainty(himalaya::Hierarch
 							      const Eigen::Matrix2d& massMatrix,
 							      const unsigned int oneLoopFlag,
 							      const unsigned int twoLoopFlag,
-							      const unsigned int threeLoopFlag){
-   double Mh;
-   double Mhcut;
+							      const unsigned int threeLoopFlag) const{
+   return getExpansionUncertainty(ho, massMatrix, oneLoopFlag, twoLoopFlag, threeLoopFlag, ExpansionFlags());
+}
+
+/**
+ * 	Estimates the uncertainty of the expansion at a given order.
+ * 	@param ho a HierarchyObject with constant isAlphab.
+ * 	@param massMatrix the CP-even Higgs mass matrix without the corrections whose uncertainty should be estimated.
+ * 	@param oneLoopFlag an integer flag which is 0 or 1 in order to estimate the uncertainty of the one-loop expansion terms.
+ * 	@param twoLoopFlag an integer flag which is 0 or 1 in order to estimate the uncertainty of the two-loop expansion terms.
+ * 	@param threeLoopFlag an integer flag which is 0 or 1 in order to estimte the uncertainty of the three-loop expansion terms.
+ * 	@param flags the expansion depth of each expansion variable. The expansion in xxMst is always done to the full depth.
+ * 	@return A double which is the estimated uncertainty.
+ */
+double himalaya::HierarchyCalculator::getExpansionUncertainty(himalaya::HierarchyObject& ho,
+							      const Eigen::Matrix2d& massMatrix,
+							      const unsigned int oneLoopFlag,
+							      const unsigned int twoLoopFlag,
+							      const unsigned int threeLoopFlag,
+							      const ExpansionFlags& flags) const{
+   ExpansionFlags expansionFlags = flags;
+   expansionFlags.set(ExpansionDepth::xxMst, 1);
+
+   // evaluate the expansion once together with the terms of the highest order of
+   // each expansion variable, which are omitted when truncating the expansion
+   std::vector<Eigen::Matrix2d> truncations;
+   const Eigen::Matrix2d massMatrixExpanded = massMatrix
+      + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag, expansionFlags, &truncations);
+
+   const double Mh = calcHiggsMass(massMatrixExpanded);
+
+   // truncate the expansion at all variables with one order lower than the expansion depth and evaluate the expansion uncertainty
+   for (auto& truncation: truncations) {
+      truncation = massMatrixExpanded - truncation;
+   }
+
+   std::vector<double> Mh2cut(truncations.size());
+   calcLowestEigenvalues(truncations.data(), truncations.size(), Mh2cut.data());
+
    std::vector<double> errors;
-   // reset flags
-   flagMap.at(ExpansionDepth::xxMst) = 1;
-   Eigen::EigenSolver<Eigen::Matrix2d> es;
-   switch (getCorrectHierarchy(ho.getSuitableHierarchy())) {
-   case Hierarchies::h3:
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mh = sortEigenvalues(es).at(0);
-      // truncate the expansion at all variables with one order lower than the expansion depth and evaluate the expansion uncertainty 
-      flagMap.at(ExpansionDepth::xxDmglst1) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
+   for (std::size_t i = 0; i < truncations.size(); i++) {
+      const double Mhcut = calcHiggsMass(truncations[i], Mh2cut[i]);
       errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxDmglst1) = 1;
-      flagMap.at(ExpansionDepth::xxDmsqst1) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
-      errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxDmsqst1) = 1;
-      flagMap.at(ExpansionDepth::xxDmst12) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
-      errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxDmst12) = 1;
-      break;
-   case Hierarchies::h4:
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mh = sortEigenvalues(es).at(0);
-      flagMap.at(ExpansionDepth::xxAt) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
-      errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxAt) = 1;
-      flagMap.at(ExpansionDepth::xxlmMsusy) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
-      errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxlmMsusy) = 1;
-      flagMap.at(ExpansionDepth::xxMsq) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
-      errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxMsq) = 1;
-      flagMap.at(ExpansionDepth::xxMsusy) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
-      errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxMsusy) = 1;
-      break;
-   case Hierarchies::h5:
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mh = sortEigenvalues(es).at(0);
-      flagMap.at(ExpansionDepth::xxDmglst1) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
-      errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxDmglst1) = 1;
-      flagMap.at(ExpansionDepth::xxMsq) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
-      errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxMsq) = 1;
-      break;
-   case Hierarchies::h6:
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mh = sortEigenvalues(es).at(0);
-      flagMap.at(ExpansionDepth::xxDmglst2) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
-      errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxDmglst2) = 1;
-      flagMap.at(ExpansionDepth::xxMsq) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
-      errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxMsq) = 1;
-      break;
-   case Hierarchies::h6b:
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mh = sortEigenvalues(es).at(0);
-      flagMap.at(ExpansionDepth::xxDmglst2) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
-      errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxDmglst2) = 1;
-      flagMap.at(ExpansionDepth::xxDmsqst2) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
-      errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxDmsqst2) = 1;
-      break;
-   case Hierarchies::h9:
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mh = sortEigenvalues(es).at(0);
-      flagMap.at(ExpansionDepth::xxDmsqst1) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
-      errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxDmsqst1) = 1;
-      flagMap.at(ExpansionDepth::xxDmst12) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
-      errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxDmst12) = 1;
-      flagMap.at(ExpansionDepth::xxMgl) = 0;
-      es.compute(massMatrix + calculateHierarchy(ho, oneLoopFlag, twoLoopFlag, threeLoopFlag), false);
-      Mhcut = sortEigenvalues(es).at(0);
-      errors.push_back(std::abs(Mh - Mhcut));
-      flagMap.at(ExpansionDepth::xxMgl) = 1;
-      break;
    }
+
    // evalue the sqrt of the squared errors
    const double squaredErrorSum =
       std::accumulate(errors.cbegin(), errors.cend(), 0.,
                       [](double l, double r) { return l + r*r; });
 
-   // set the expansion depth for the next comparison
-   flagMap.at(ExpansionDepth::xxMst) = 0;
-   flagMap.at(ExpansionDepth::xx) = 0;
-
    return std::sqrt(squaredErrorSum);
 }
 
@@ -1460,7 +2191,7 @@ double himalaya::HierarchyCalculator::getExpansionUncertainty(himalaya::Hierarch
  * 	@throws runtime_error Throws a runtime_error if the given hierarchy is not included.
  * 	@returns The key of the mother hierarchy.
  */
-int himalaya::HierarchyCalculator::getCorrectHierarchy(const int hierarchy){
+int himalaya::HierarchyCalculator::getCorrectHierarchy(const int hierarchy) const{
    if(hierarchy < 0 || hierarchy > 13){
       if(hierarchy == -1){
 	 throw std::runtime_error("No suitable hierarchy found!");
@@ -1474,7 +2205,7 @@ int himalaya::HierarchyCalculator::getCorrectHierarchy(const int hierarchy){
 /**
  * 	Prints out some information about Himalaya.
  */
-void himalaya::HierarchyCalculator::printInfo() {
+void himalaya::HierarchyCalculator::printInfo() const {
    std::cerr << "....................................................................................\n";
    std::cerr << "Himalaya " << Himalaya_VERSION_MAJOR << "." << Himalaya_VERSION_MINOR << "." << Himalaya_VERSION_RELEASE << "\tѧѦѧ \n";
    std::cerr << "Uses code by P. Slavich et al. (2-loop αt*αs) [hep-ph/0105096].\n";
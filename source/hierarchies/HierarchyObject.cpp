@@ -71,6 +71,36 @@ double himalaya::HierarchyObject::getRelDiff2L() const{
    return relDiff2L;
 }
 
+/**
+ * 	Sets the number of expansion uncertainty estimates which have been skipped by the pruning of the hierarchy selection
+ * 	@param skipped the number of skipped estimates.
+ */
+void himalaya::HierarchyObject::setSkippedUncertaintyEstimates(int skipped){
+   skippedUncertaintyEstimates = skipped;
+}
+
+/**
+ * 	@return The number of expansion uncertainty estimates which have been skipped by the pruning of the hierarchy selection.
+ */
+int himalaya::HierarchyObject::getSkippedUncertaintyEstimates() const{
+   return skippedUncertaintyEstimates;
+}
+
+/**
+ * 	Sets the result fields which should be calculated
+ * 	@param resultFields a combination of ResultFields flags.
+ */
+void himalaya::HierarchyObject::setResultFields(unsigned int resultFields){
+   this -> resultFields = resultFields;
+}
+
+/**
+ * 	@return The result fields which have been calculated, a combination of ResultFields flags.
+ */
+unsigned int himalaya::HierarchyObject::getResultFields() const{
+   return resultFields;
+}
+
 
 /**
  * 	Sets the uncertainty of the expansion at a given loop level.
@@ -454,10 +484,11 @@ std::string himalaya::HierarchyObject::getH3mHierarchyNotation(int hierarchy) co
 }
 
 /**
- * 	Prints out all information of the HierarchyObject
+ * 	Prints out all information of the HierarchyObject, which has been calculated
  */
 std::ostream& himalaya::operator<<(std::ostream& ostr, himalaya::HierarchyObject const &ho){
    const int suitableHierarchy = ho.getSuitableHierarchy();
+   const unsigned int resultFields = ho.getResultFields();
    const std::string renSchemeString = (ho.getRenormalizationScheme() == RenSchemes::H3m 
       || ho.getRenormalizationScheme() == RenSchemes::H3mMDRBAR) ? "H3m scheme" : "DR'";
    const std::string massString = ho.getIsAlphab() ? "Msbottom" : "Mstop";
@@ -466,41 +497,64 @@ std::ostream& himalaya::operator<<(std::ostream& ostr, himalaya::HierarchyObject
 	<< "Himalaya HierarchyObject parameters\n"
         << "===================================\n"
 	<< "Ren. scheme               =  " << renSchemeString << "\n"
-        << "Hierarchy                 =  " << suitableHierarchy << " (" << ho.getH3mHierarchyNotation(suitableHierarchy) << ")\n"
-	<< massString << "_1" << spaces << "=  " << ho.getMDRMasses()(0) << " GeV (MDR')\n"
-	<< massString << "_2" << spaces << "=  " << ho.getMDRMasses()(1) << " GeV (MDR')\n"
-        << "Abs. diff 2L              =  " << ho.getAbsDiff2L() << " GeV\n"
+        << "Hierarchy                 =  " << suitableHierarchy << " (" << ho.getH3mHierarchyNotation(suitableHierarchy) << ")\n";
+   if (resultFields & ResultFields::MDR_SHIFT) {
+      ostr << massString << "_1" << spaces << "=  " << ho.getMDRMasses()(0) << " GeV (MDR')\n"
+	   << massString << "_2" << spaces << "=  " << ho.getMDRMasses()(1) << " GeV (MDR')\n";
+   }
+   ostr << "Abs. diff 2L              =  " << ho.getAbsDiff2L() << " GeV\n"
         << "Rel. diff 2L              =  " << ho.getRelDiff2L()*100 << " %\n"
         << "Mh^2_0L                   =  {{" << ho.getDMh(0).row(0)(0) << ", " << ho.getDMh(0).row(0)(1)
-		   << "}, {" << ho.getDMh(0).row(1)(0) << ", " << ho.getDMh(0).row(1)(1) << "}} GeV^2\n"
-        << "ΔMh^2_1L                  =  {{" << ho.getDMh(1).row(0)(0) << ", " << ho.getDMh(1).row(0)(1)
+		   << "}, {" << ho.getDMh(0).row(1)(0) << ", " << ho.getDMh(0).row(1)(1) << "}} GeV^2\n";
+   if (resultFields & ResultFields::DMH) {
+      ostr << "ΔMh^2_1L                  =  {{" << ho.getDMh(1).row(0)(0) << ", " << ho.getDMh(1).row(0)(1)
 		   << "}, {" << ho.getDMh(1).row(1)(0) << ", " << ho.getDMh(1).row(1)(1) << "}} GeV^2\n"
-        << "ΔMh^2_2L                  =  {{" << ho.getDMh(2).row(0)(0) << ", " << ho.getDMh(2).row(0)(1)
+           << "ΔMh^2_2L                  =  {{" << ho.getDMh(2).row(0)(0) << ", " << ho.getDMh(2).row(0)(1)
 		   << "}, {" << ho.getDMh(2).row(1)(0) << ", " << ho.getDMh(2).row(1)(1) << "}} GeV^2\n"
-        << "ΔMh^2_3L                  =  {{" << ho.getDMh(3).row(0)(0) << ", " << ho.getDMh(3).row(0)(1)
-		   << "}, {" << ho.getDMh(3).row(1)(0) << ", " << ho.getDMh(3).row(1)(1) << "}} GeV^2\n"
-        << "Exp. uncert. 1L           =  " << ho.getDMhExpUncertainty(1) << " GeV\n"
-        << "Exp. uncert. 2L           =  " << ho.getDMhExpUncertainty(2) << " GeV\n"
-        << "Exp. uncert. 3L           =  " << ho.getDMhExpUncertainty(3) << " GeV\n"
-	<< "DR' -> MDR' shift         =  {{" << ho.getDMhDRbarPrimeToMDRbarPrimeShift().row(0)(0) << ", " << ho.getDMhDRbarPrimeToMDRbarPrimeShift().row(0)(1)
-		   << "}, {" << ho.getDMhDRbarPrimeToMDRbarPrimeShift().row(1)(0) << ", " << ho.getDMhDRbarPrimeToMDRbarPrimeShift().row(1)(1)  << "}} GeV^2\n"
-	<< "DR' -> H3m shift          =  {{" << ho.getDMhDRbarPrimeToH3mShift().row(0)(0) << ", " << ho.getDMhDRbarPrimeToH3mShift().row(0)(1)
-		   << "}, {" << ho.getDMhDRbarPrimeToH3mShift().row(1)(0) << ", " << ho.getDMhDRbarPrimeToH3mShift().row(1)(1) << "}} GeV^2\n"
-	<< "Δλ_0L                     =  " << ho.getDLambda(0) << " O(g_1^2, g_2^2)\n"
-	<< "Δλ_1L                     =  " << ho.getDLambda(1) << " O(α_t)\n"
-	<< "Δλ_2L                     =  " << ho.getDLambda(2) << " O(α_t*α_s)\n"
-        << "Δλ_EFT_3L                 =  " << ho.getDLambdaEFT() << " +/- " << ho.getDLambdaEFTUncertainty() << " O(α_t*α_s^2)\n"
-	<< "Δλ_H3m_3L                 =  " << ho.getDLambdaH3m() << " +/- " << ho.getDLambdaH3mUncertainty() << " O(α_t*α_s^2)\n"
-	<< "Δλ_0L DR' -> MS shift     =  " << ho.getDLambdaDRbarPrimeToMSbarShift(0) << "\n"
-	<< "Δλ_1L DR' -> MS shift     =  " << ho.getDLambdaDRbarPrimeToMSbarShift(1) << "\n"
-	<< "Δλ_2L DR' -> MS shift     =  " << ho.getDLambdaDRbarPrimeToMSbarShift(2) << "\n"
-	<< "Δλ_EFT_3L DR' -> MS shift =  " << ho.getDLambdaEFTDRbarPrimeToMSbarShift() << "\n"
-	<< "Δλ_H3m_3L DR' -> MS shift =  " << ho.getDLambdaH3mDRbarPrimeToMSbarShift() << "\n"
-	<< "Mh^2_EFT_0L               =  " << ho.getDMh2EFT(0) << " GeV^2 O(g_1^2, g_2^2)\n"
-	<< "ΔMh^2_EFT_1L              =  " << ho.getDMh2EFT(1) << " GeV^2 O(α_t)\n"
-	<< "ΔMh^2_EFT_2L              =  " << ho.getDMh2EFT(2) << " GeV^2 O(α_t*α_s)\n"
-	<< "ΔMh^2_EFT_3L              =  " << ho.getDMh2EFT(3) << " GeV^2 O(α_t*α_s^2)"
-        << '\n';
+           << "ΔMh^2_3L                  =  {{" << ho.getDMh(3).row(0)(0) << ", " << ho.getDMh(3).row(0)(1)
+		   << "}, {" << ho.getDMh(3).row(1)(0) << ", " << ho.getDMh(3).row(1)(1) << "}} GeV^2\n";
+   }
+   if (resultFields & ResultFields::EXPANSION_UNCERTAINTY) {
+      ostr << "Exp. uncert. 1L           =  " << ho.getDMhExpUncertainty(1) << " GeV\n"
+           << "Exp. uncert. 2L           =  " << ho.getDMhExpUncertainty(2) << " GeV\n"
+           << "Exp. uncert. 3L           =  " << ho.getDMhExpUncertainty(3) << " GeV\n";
+   }
+   if (resultFields & ResultFields::MDR_SHIFT) {
+      ostr << "DR' -> MDR' shift         =  {{" << ho.getDMhDRbarPrimeToMDRbarPrimeShift().row(0)(0) << ", " << ho.getDMhDRbarPrimeToMDRbarPrimeShift().row(0)(1)
+		   << "}, {" << ho.getDMhDRbarPrimeToMDRbarPrimeShift().row(1)(0) << ", " << ho.getDMhDRbarPrimeToMDRbarPrimeShift().row(1)(1)  << "}} GeV^2\n";
+   }
+   if (resultFields & ResultFields::H3M_SHIFT) {
+      ostr << "DR' -> H3m shift          =  {{" << ho.getDMhDRbarPrimeToH3mShift().row(0)(0) << ", " << ho.getDMhDRbarPrimeToH3mShift().row(0)(1)
+		   << "}, {" << ho.getDMhDRbarPrimeToH3mShift().row(1)(0) << ", " << ho.getDMhDRbarPrimeToH3mShift().row(1)(1) << "}} GeV^2\n";
+   }
+   if (resultFields & ResultFields::DLAMBDA) {
+      // the expansion uncertainties of delta_lambda are only available together with the ones of the mass matrix
+      const bool withUncertainties = resultFields & ResultFields::EXPANSION_UNCERTAINTY;
+      ostr << "Δλ_0L                     =  " << ho.getDLambda(0) << " O(g_1^2, g_2^2)\n"
+	   << "Δλ_1L                     =  " << ho.getDLambda(1) << " O(α_t)\n"
+	   << "Δλ_2L                     =  " << ho.getDLambda(2) << " O(α_t*α_s)\n"
+           << "Δλ_EFT_3L                 =  " << ho.getDLambdaEFT();
+      if (withUncertainties) {
+	 ostr << " +/- " << ho.getDLambdaEFTUncertainty();
+      }
+      ostr << " O(α_t*α_s^2)\n"
+	   << "Δλ_H3m_3L                 =  " << ho.getDLambdaH3m();
+      if (withUncertainties) {
+	 ostr << " +/- " << ho.getDLambdaH3mUncertainty();
+      }
+      ostr << " O(α_t*α_s^2)\n"
+	   << "Δλ_0L DR' -> MS shift     =  " << ho.getDLambdaDRbarPrimeToMSbarShift(0) << "\n"
+	   << "Δλ_1L DR' -> MS shift     =  " << ho.getDLambdaDRbarPrimeToMSbarShift(1) << "\n"
+	   << "Δλ_2L DR' -> MS shift     =  " << ho.getDLambdaDRbarPrimeToMSbarShift(2) << "\n"
+	   << "Δλ_EFT_3L DR' -> MS shift =  " << ho.getDLambdaEFTDRbarPrimeToMSbarShift() << "\n"
+	   << "Δλ_H3m_3L DR' -> MS shift =  " << ho.getDLambdaH3mDRbarPrimeToMSbarShift() << "\n";
+   }
+   if (resultFields & ResultFields::EFT) {
+      ostr << "Mh^2_EFT_0L               =  " << ho.getDMh2EFT(0) << " GeV^2 O(g_1^2, g_2^2)\n"
+	   << "ΔMh^2_EFT_1L              =  " << ho.getDMh2EFT(1) << " GeV^2 O(α_t)\n"
+	   << "ΔMh^2_EFT_2L              =  " << ho.getDMh2EFT(2) << " GeV^2 O(α_t*α_s)\n"
+	   << "ΔMh^2_EFT_3L              =  " << ho.getDMh2EFT(3) << " GeV^2 O(α_t*α_s^2)\n";
+   }
 
    return ostr;
 }
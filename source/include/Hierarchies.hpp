@@ -54,6 +54,48 @@ enum ExpansionDepth : int {
 
 } // namespace ExpansionDepth
 
+/**
+ * 	Flags which determine the expansion depth of each expansion
+ * 	variable, indexed by the ExpansionDepth enum.  A flag of 1 means
+ * 	that the expansion variable is expanded to the full depth and a
+ * 	flag of 0 means that the expansion is truncated by one order.
+ *
+ * 	The flags are stored in the bits of a single integer, such that
+ * 	they can be copied without any allocation.  The integer is
+ * 	available at compile time, so it can be used as a template
+ * 	argument, e.g. to specialize on the default configuration FULL.
+ */
+class ExpansionFlags {
+public:
+   /// all expansion variables are expanded to the full depth
+   static constexpr unsigned int FULL = (1u << (ExpansionDepth::NUMBER_OF_EXPANSIONS - ExpansionDepth::FIRST)) - 1u;
+
+   /// constructs flags where all expansion variables are expanded to the full depth
+   constexpr ExpansionFlags() noexcept : bits(FULL) {}
+   /// constructs flags from their bit representation
+   constexpr explicit ExpansionFlags(unsigned int bits_) noexcept : bits(bits_ & FULL) {}
+
+   /// returns the flag (0 or 1) of the given expansion variable
+   constexpr unsigned int at(ExpansionDepth::ExpansionDepth variable) const noexcept {
+      return (bits >> (variable - ExpansionDepth::FIRST)) & 1u;
+   }
+   /// sets the flag of the given expansion variable to 0 or 1
+   void set(ExpansionDepth::ExpansionDepth variable, unsigned int flag) noexcept {
+      const unsigned int mask = 1u << (variable - ExpansionDepth::FIRST);
+      bits = flag ? (bits | mask) : (bits & ~mask);
+   }
+   /// returns the bit representation of the flags
+   constexpr unsigned int getBits() const noexcept { return bits; }
+   /// returns true if all expansion variables are expanded to the full depth
+   constexpr bool isFull() const noexcept { return bits == FULL; }
+
+   constexpr bool operator==(const ExpansionFlags& other) const noexcept { return bits == other.bits; }
+   constexpr bool operator!=(const ExpansionFlags& other) const noexcept { return bits != other.bits; }
+
+private:
+   unsigned int bits; ///< one bit per expansion variable
+};
+
 /// Mass schemes
 namespace MassSchemes{
    
@@ -142,6 +184,40 @@ namespace ThresholdVariables{
    };
 } // namespace ThresholdVariables
 
+/// Input parameters with respect to which the gradients of the three-loop results are calculated
+namespace GradientVariables{
+
+   /// the independent variables, which refer to the sbottoms instead of the stops for corrections proportional to alpha_b
+   enum GradientVariables : int{
+      MST1,                        ///< the stop/sbottom 1 mass, Parameters::MSt(0) or Parameters::MSb(0)
+      MST2,                        ///< the stop/sbottom 2 mass, Parameters::MSt(1) or Parameters::MSb(1)
+      S2T,                         ///< the sine of 2 times the stop/sbottom mixing angle, Parameters::s2t or Parameters::s2b
+      MG,                          ///< the gluino mass, Parameters::MG
+      AT,                          ///< the trilinear coupling, Parameters::Au(2,2) or Parameters::Ad(2,2)
+      MU,                          ///< the mu parameter, Parameters::mu
+      SCALE,                       ///< the renormalization scale, Parameters::scale
+      G3,                          ///< the strong gauge coupling, Parameters::g3
+      VU,                          ///< the up-type Higgs VEV, Parameters::vu
+      VD,                          ///< the down-type Higgs VEV, Parameters::vd
+      NUMBER_OF_GRADIENT_VARIABLES ///< Number of variables
+   };
+} // namespace GradientVariables
+
+/// Result fields of the HierarchyObject
+namespace ResultFields{
+
+   /// result field flags, which can be combined with a bitwise or
+   enum ResultFields : unsigned int{
+      DMH                   = 1u << 0, ///< the 1-, 2- and 3-loop Higgs mass matrices
+      EXPANSION_UNCERTAINTY = 1u << 1, ///< the 3-loop expansion uncertainties of the mass matrix and of delta_lambda
+      DLAMBDA               = 1u << 2, ///< delta_lambda up to 3-loop, its DR' -> MS shifts and Xt uncertainties
+      EFT                   = 1u << 3, ///< the EFT Higgs mass up to 3-loop, implies DLAMBDA
+      H3M_SHIFT             = 1u << 4, ///< the DR' -> H3m shift of the mass matrix
+      MDR_SHIFT             = 1u << 5, ///< the DR' -> MDR' shift of the mass matrix and the MDR masses, implies DMH
+      ALL                   = (1u << 6) - 1 ///< all result fields
+   };
+} // namespace ResultFields
+
 namespace EFTOrders{
    
    /// Order flags
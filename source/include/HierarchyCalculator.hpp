@@ -7,14 +7,70 @@
 
 #pragma once
 
+#include "Dual.hpp"
 #include "Hierarchies.hpp"
 #include "Himalaya_interface.hpp"
 #include "HierarchyObject.hpp"
+#include "Kinematics.hpp"
+#include "LogCoefficients.hpp"
+#include "XtPolynomial.hpp"
 #include "version.hpp"
+#include <array>
 #include <map>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace himalaya{
+   class ThreadPool;
+
+   /**
+    * 	The three-loop threshold correction to the quartic Higgs coupling at O(alpha_t*alpha_s^2)
+    */
+   struct DeltaLambda3L{
+      int hierarchy{-1};				///< the suitable hierarchy
+      double dLambda{};					///< delta_lambda in the DR' scheme, see HierarchyObject::getDLambda(3)
+      double dLambdaDRbarPrimeToMSbarShift{};		///< the DR' -> MS shift of delta_lambda
+      double dLambdaXtUncertainty{};			///< the uncertainty of delta_lambda due to missing Xt terms
+      double dLambdaExpUncertainty{};			///< the expansion uncertainty of delta_lambda, if it has been estimated
+   };
+
+   /**
+    * 	The three-loop Higgs mass matrix and delta_lambda of a fixed hierarchy together with their gradients
+    * 	with respect to the GradientVariables
+    */
+   struct Gradients3L{
+      int hierarchy{-1};				///< the hierarchy
+      Eigen::Matrix2d DMh3L{Eigen::Matrix2d::Zero()};	///< the three-loop Higgs mass matrix in the DR' scheme, see HierarchyObject::getDMh(3)
+      std::array<Eigen::Matrix2d, GradientVariables::NUMBER_OF_GRADIENT_VARIABLES> DMh3LGradient{};	///< the derivatives of DMh3L
+      double DLambda3L{};				///< delta_lambda in the DR' scheme, see HierarchyObject::getDLambda(3), zero for alpha_b
+      std::array<double, GradientVariables::NUMBER_OF_GRADIENT_VARIABLES> DLambda3LGradient{};	///< the derivatives of DLambda3L
+   };
+
+   /**
+    * 	The three-loop Higgs mass matrix, delta_lambda and the threshold corrections of a fixed hierarchy as polynomials
+    * 	in lmMst1 = log(mu^2/Mst1^2), where mu is the renormalization scale and all masses and couplings are kept fixed
+    */
+   struct ScaleDependence3L{
+      int hierarchy{-1};				///< the hierarchy
+      double Mst1{};					///< the stop/sbottom 1 mass in lmMst1
+      LogCoefficients<Eigen::Matrix2d> DMh3L{};		///< the three-loop Higgs mass matrix in the DR' scheme, see HierarchyObject::getDMh(3)
+      LogCoefficients<double> DLambda3L{};		///< delta_lambda in the DR' scheme, see HierarchyObject::getDLambda(3), zero for alpha_b
+      std::array<LogCoefficients<double>, ThresholdVariables::NUMBER_OF_THRESHOLD_VARIALES> thresholdCorrections{};	///< the DR' threshold corrections including all log mu terms, zero for alpha_b
+      /// returns lmMst1 at the renormalization scale mu
+      double getLogarithm(double mu) const { return std::log(pow2(mu / Mst1)); }
+   };
+
+   /**
+    * 	The threshold corrections to the quartic Higgs coupling of a fixed hierarchy as polynomials in Xt, where the stop masses,
+    * 	all other masses and the couplings are kept fixed and sin(2*theta_t) follows from Xt
+    */
+   struct XtDependence3L{
+      int hierarchy{-1};				///< the hierarchy
+      std::array<XtPolynomial, 4> DLambda{};		///< delta_lambda in the DR' scheme up to three-loop level, see HierarchyObject::getDLambda
+      std::array<XtPolynomial, 4> DLambdaDRbarPrimeToMSbarShift{};	///< the DR' -> MS shifts of delta_lambda, see HierarchyObject::getDLambdaDRbarPrimeToMSbarShift
+   };
+
    /**
     * The HierarchyCalculatur class 
     */
@@ -29,15 +85,93 @@ namespace himalaya{
       /**
        * 	Calculates the 3-loop mass matrix and other information of the hierarchy selection process.
        * 	@param isAlphab a bool which determines if the returned object is proportinal to alpha_b.
+       * 	@param resultFields a combination of ResultFields flags, which determines the calculated results besides the hierarchy selection.
+       * 	The getters of the results which have not been calculated throw or return zero.
        * 	@return A HierarchyObject which holds all information of the calculation.
        */
-      HierarchyObject calculateDMh3L(bool isAlphab);
+      HierarchyObject calculateDMh3L(bool isAlphab, unsigned int resultFields = ResultFields::ALL) const;
+      /**
+       * 	Calculates the 3-loop mass matrices and other information of the hierarchy selection process proportional to alpha_t and to alpha_b.
+       * 	Both calculations share the initialization of this calculator and run concurrently on two threads.
+       * 	@param resultFields a combination of ResultFields flags, which determines the calculated results besides the hierarchy selection.
+       * 	@throws The exception of the alpha_t calculation, or of the alpha_b calculation if only the latter failed.
+       * 	@return The HierarchyObjects proportional to alpha_t (0) and alpha_b (1), which are equal to the ones of calculateDMh3L(false) and calculateDMh3L(true).
+       */
+      std::array<HierarchyObject, 2> calculateDMh3LTopAndBottom(unsigned int resultFields = ResultFields::ALL) const;
+      /**
+       * 	Calculates delta_lambda at three-loop level, its DR' -> MS shift and its uncertainties without the Higgs mass matrices of the suitable hierarchy.
+       * 	Only the hierarchy selection, the log coefficients of the suitable hierarchy and the threshold corrections are evaluated,
+       * 	which is cheaper than calculateDMh3L(false, ResultFields::DLAMBDA).
+       * 	@param withExpUncertainty a bool to estimate the expansion uncertainty, which requires the three-loop Higgs mass matrix.
+       * 	@return The three-loop delta_lambda of the suitable hierarchy, which is equal to HierarchyObject::getDLambda(3).
+       */
+      DeltaLambda3L calculateDLambda3L(bool withExpUncertainty = false) const;
+      /**
+       * 	Calculates the three-loop Higgs mass matrix and delta_lambda together with their gradients with respect to the GradientVariables
+       * 	for the hierarchy of a HierarchyObject, which is kept fixed.  The hierarchy kernels are evaluated once with dual numbers.
+       * 	@param ho a HierarchyObject with constant isAlphab and the suitable hierarchy in the DR' scheme, e.g. returned by calculateDMh3L.
+       * 	@throws runtime_error Throws a runtime_error if the HierarchyObject is in the MDR scheme.
+       * 	@return The three-loop results and their gradients.
+       */
+      Gradients3L calculateGradients3L(const HierarchyObject& ho) const;
+      /**
+       * 	Calculates the three-loop Higgs mass matrix, delta_lambda and the threshold corrections as polynomials in log(mu^2/Mst1^2)
+       * 	for the hierarchy of a HierarchyObject, which is kept fixed.  The results at any renormalization scale mu can be
+       * 	evaluated with LogCoefficients::eval(ScaleDependence3L::getLogarithm(mu)) then.
+       * 	@param ho a HierarchyObject with constant isAlphab and the suitable hierarchy in the DR' scheme, e.g. returned by calculateDMh3L.
+       * 	@throws runtime_error Throws a runtime_error if the HierarchyObject is in the MDR scheme.
+       * 	@return The coefficients of the three-loop results.
+       */
+      ScaleDependence3L calculateScaleDependence3L(const HierarchyObject& ho) const;
+      /**
+       * 	Calculates delta_lambda and its DR' -> MS shifts as polynomials in Xt for the hierarchy of a HierarchyObject, which is kept fixed.
+       * 	The polynomials are interpolated in the range of Xt which is allowed by the stop masses, i.e. |sin(2*theta_t)| <= 1.
+       * 	@param ho a HierarchyObject proportional to alpha_t with the suitable hierarchy in the DR' scheme, e.g. returned by calculateDMh3L(false).
+       * 	@throws runtime_error Throws a runtime_error if the HierarchyObject is proportional to alpha_b or in the MDR scheme.
+       * 	@return The coefficients of delta_lambda and of its shifts.
+       */
+      XtDependence3L calculateXtDependence3L(const HierarchyObject& ho) const;
+      /**
+       * 	Calculates the 3-loop mass matrices and other information of the hierarchy selection process for many parameter points in parallel.
+       * 	The parameter points are distributed over a work-stealing thread pool, where each point is calculated by a non-verbose HierarchyCalculator.
+       * 	@param points the Himalaya input parameters of all points.
+       * 	@param isAlphab a bool which determines if the returned objects are proportinal to alpha_b.
+       * 	@param numberOfWorkers the number of worker threads. If 0, the number of hardware threads is used.
+       * 	@param pruneHierarchies a bool to enable the pruning of the hierarchy selection, see setHierarchyPruning.
+       * 	@param resultFields a combination of ResultFields flags, which determines the calculated results besides the hierarchy selection.
+       * 	@throws The exception of the first parameter point whose calculation failed, after all points are calculated.
+       * 	@return A vector of HierarchyObjects, where the i-th element holds all information of the calculation of the i-th point.
+       */
+      static std::vector<HierarchyObject> calculateDMh3L(const std::vector<Parameters>& points, bool isAlphab, unsigned int numberOfWorkers = 0,
+                                                         bool pruneHierarchies = false, unsigned int resultFields = ResultFields::ALL);
+      /**
+       * 	Calculates the 3-loop mass matrices and other information of the hierarchy selection process for many parameter points in parallel.
+       * 	The points are screened for their suitable hierarchies first.  Afterwards the hierarchy candidates and finally the selected
+       * 	hierarchies are evaluated bucket by bucket, such that the points of the same hierarchy are calculated one after the other.
+       * 	The work of each stage is distributed over the given thread pool, where each point is calculated by a non-verbose HierarchyCalculator.
+       * 	@param points the Himalaya input parameters of all points.
+       * 	@param isAlphab a bool which determines if the returned objects are proportinal to alpha_b.
+       * 	@param pool the thread pool, which can be reused for several batches.
+       * 	@param pruneHierarchies a bool to enable the pruning of the hierarchy selection, see setHierarchyPruning.
+       * 	@param resultFields a combination of ResultFields flags, which determines the calculated results besides the hierarchy selection.
+       * 	@throws The exception of the first parameter point whose calculation failed, after all points are calculated.
+       * 	@return A vector of HierarchyObjects, where the i-th element holds all information of the calculation of the i-th point.
+       */
+      static std::vector<HierarchyObject> calculateDMh3L(const std::vector<Parameters>& points, bool isAlphab, ThreadPool& pool,
+                                                         bool pruneHierarchies = false, unsigned int resultFields = ResultFields::ALL);
       /**
        * 	Compares deviation of all hierarchies with the exact two-loop result and returns the hierarchy which minimizes the error.
        * 	@param ho a HierarchyObject with constant isAlphab.
        * 	@return An integer which is identified with the suitable hierarchy.
        */
-      int compareHierarchies(HierarchyObject& ho);
+      int compareHierarchies(HierarchyObject& ho) const;
+      /**
+       * 	Enables or disables the pruning of the hierarchy selection. If enabled, the expansion uncertainties of a hierarchy candidate
+       * 	are only estimated if its deviation from the exact two-loop result does not exceed the error of the best candidate found so far.
+       * 	The selected hierarchy and its errors are the same as without pruning.
+       * 	@param prune a bool to enable (true) or disable (false) the pruning.
+       */
+      void setHierarchyPruning(bool prune);
       /**
        * 	Calculates the hierarchy contributions for a specific hierarchy at a specific loop order.
        * 	@param ho a HierarchyObject with constant isAlphab.
@@ -47,7 +181,7 @@ namespace himalaya{
        * 	@throws runtime_error Throws a runtime_error if the tree-level is requested in terms of hierarchies.
        * 	@return The loop corrected Higgs mass matrix which contains the expanded corrections at the given order.
        */
-      Eigen::Matrix2d calculateHierarchy(himalaya::HierarchyObject& ho, const int oneLoopFlagIn, const int twoLoopFlagIn, const int threeLoopFlagIn);
+      Eigen::Matrix2d calculateHierarchy(himalaya::HierarchyObject& ho, const int oneLoopFlagIn, const int twoLoopFlagIn, const int threeLoopFlagIn) const;
       /**
        * 	Calculates the contribution to the order (alpha_x) and (alpha_s alpha_x) as the difference
        *	of the Higgs mass matrices of the MDR and DR scheme. Here, x can be t or b.
@@ -56,7 +190,7 @@ namespace himalaya{
        * 	@param shiftTwoLoop a bool to shift the terms at two-loop level.
        * 	@return The loop corrected Higgs mass matrix difference of the MDR and DR scheme at the given order.
        */
-      Eigen::Matrix2d calcDRbarToMDRbarShift(const HierarchyObject& ho, const bool shiftOneLoop, const bool shiftTwoLoop);
+      Eigen::Matrix2d calcDRbarToMDRbarShift(const HierarchyObject& ho, const bool shiftOneLoop, const bool shiftTwoLoop) const;
       /**
        * 	Calculates the loop corrected Higgs mass matrix at the order O(alpha_x). Here, x can be t or b.
        * 	@param ho a HierarchyObject with constant isAlphab.
@@ -64,7 +198,7 @@ namespace himalaya{
        * 	@param shiftTwoLoop An integer flag which is 0 or 1 in order to shift the two-loop terms to the MDR scheme.
        * 	@return The loop corrected Higgs mass matrix at the order O(alpha_x).
        */
-      Eigen::Matrix2d getMt41L(const HierarchyObject& ho, const unsigned int shiftOneLoop, const unsigned int shiftTwoLoop);
+      Eigen::Matrix2d getMt41L(const HierarchyObject& ho, const unsigned int shiftOneLoop, const unsigned int shiftTwoLoop) const;
       /**
        * 	Calculates the loop corrected Higgs mass matrix at the order O(alpha_x*alpha_s). Here, x can be t or b.
        * 	@param ho a HierarchyObject with constant isAlphab.
@@ -72,7 +206,7 @@ namespace himalaya{
        * 	@param shiftTwoLoop An integer flag which is 0 or 1 in order to shift the two-loop terms to the MDR scheme.
        * 	@return The loop corrected Higgs mass matrix at the order O(alpha_x*alpha_s).
        */
-      Eigen::Matrix2d getMt42L(const HierarchyObject& ho, const unsigned int shiftOneLoop, const unsigned int shiftTwoLoop);
+      Eigen::Matrix2d getMt42L(const HierarchyObject& ho, const unsigned int shiftOneLoop, const unsigned int shiftTwoLoop) const;
       /**
        *	Shifts Msx1 according to the hierarchy to the MDR scheme.
        * 	@param ho a HierarchyObject with constant isAlphab.
@@ -80,7 +214,7 @@ namespace himalaya{
        * 	@param twoLoopFlag an integer flag which is 0 or 1 in order to shift the order O(alpha_s^2).
        * 	@return A double which is the MDR sx_1 mass.
        */
-      double shiftMst1ToMDR(const HierarchyObject& ho, const unsigned int oneLoopFlag, const unsigned int twoLoopFlag);
+      double shiftMst1ToMDR(const HierarchyObject& ho, const unsigned int oneLoopFlag, const unsigned int twoLoopFlag) const;
       /**
        *	Shifts Mst2 according to the hierarchy to the MDR scheme.
        * 	@param ho a HierarchyObject with constant isAlphab.
@@ -88,7 +222,7 @@ namespace himalaya{
        * 	@param twoLoopFlag an integer flag which is 0 or 1 in order to shift the order O(alpha_s^2).
        * 	@return A double which is the MDR stop_2 mass.
        */
-      double shiftMst2ToMDR(const HierarchyObject& ho, const unsigned int oneLoopFlag, const unsigned int twoLoopFlag);
+      double shiftMst2ToMDR(const HierarchyObject& ho, const unsigned int oneLoopFlag, const unsigned int twoLoopFlag) const;
       /**
        * 	Estimates the uncertainty of the expansion at a given order.
        * 	@param ho a HierarchyObject with constant isAlphab.
@@ -99,8 +233,28 @@ namespace himalaya{
        * 	@return A double which is the estimated uncertainty.
        */
       double getExpansionUncertainty(himalaya::HierarchyObject& ho, const Eigen::Matrix2d& massMatrix, const unsigned int oneLoopFlag, 
-				     const unsigned int twoLoopFlag, const unsigned int threeLoopFlag);
+				     const unsigned int twoLoopFlag, const unsigned int threeLoopFlag) const;
    private:
+      /// key of the memoized exact Higgs mass matrices: (isAlphab, Mst1, Mst2) with the (shifted) stop/sbottom masses
+      typedef std::tuple<bool, double, double> ExactMassMatrixKey;
+      /// memoized exact Higgs mass matrices, which live on the call stack of a single calculation
+      struct ExactMassMatrixCache {
+         std::map<ExactMassMatrixKey, Eigen::Matrix2d> Mt41L{}; ///< memoized results of getMt41L
+         std::map<ExactMassMatrixKey, Eigen::Matrix2d> Mt42L{}; ///< memoized results of getMt42L
+      };
+
+      /// deviation of the expansion of a hierarchy candidate from the exact two-loop result
+      struct HierarchyError {
+         double Mh2l{};             ///< exact two-loop Higgs mass
+         double twoLoopError{};     ///< deviation of the expanded from the exact two-loop Higgs mass
+         double expUncertainty2L{}; ///< uncertainty of the expansion at two-loop level
+         double expUncertainty3L{}; ///< uncertainty of the expansion at three-loop level
+         /// @return The combined error, which is minimized by the hierarchy selection.
+         double getCombinedError() const;
+      };
+      /// hierarchy candidates and their errors in ascending order of the hierarchies
+      typedef std::vector<std::pair<int, HierarchyError>> HierarchyErrors;
+
       Parameters p{};     ///< Himalaya input parameters
       double Al4p{};      ///< alpha_s/(4*Pi)
       double lmMgl{};     ///< log(pow2(p.scale / Mgl))
@@ -108,7 +262,9 @@ namespace himalaya{
       double Mgl{};       ///< Gluino mass
       double Msq{};       ///< mean light squark mass
       double prefac{};    ///< prefactor of the Higgs mass matrix
+      std::array<Kinematics<double>, 2> kinematics{}; ///< kinematics of the stops (0) and sbottoms (1) with the DR'-bar masses
       bool verbose{true}; ///< enable/disable verbose output
+      bool pruneHierarchies{false}; ///< enable/disable the pruning of the hierarchy selection
       /**
        * 	Initializes all common variables.
        */
@@ -118,20 +274,148 @@ namespace himalaya{
        * 	@param ho a HierarchyObject with constant isAlphab and a hierarchy candidate.
        * 	@returns A bool if the hierarchy candidate is suitable to the given mass spectrum.
        */
-      bool isHierarchySuitable(const HierarchyObject& ho);
+      bool isHierarchySuitable(const HierarchyObject& ho) const;
+      /**
+       * 	Compares deviation of all hierarchies with the exact two-loop result and returns the hierarchy which minimizes the error.
+       * 	@param ho a HierarchyObject with constant isAlphab.
+       * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+       * 	@return An integer which is identified with the suitable hierarchy.
+       */
+      int compareHierarchies(HierarchyObject& ho, ExactMassMatrixCache& cache) const;
+      /**
+       * 	Calculates the tree-level Higgs mass matrix.
+       * 	@return The tree-level CP-even Higgs mass matrix.
+       */
+      Eigen::Matrix2d getTreeLevelMassMatrix() const;
+      /**
+       * 	Estimates the error of a hierarchy candidate by comparing the expanded with the exact two-loop Higgs mass.
+       * 	@param ho a HierarchyObject with constant isAlphab, the tree-level mass matrix and the hierarchy candidate.
+       * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+       * 	@return The deviation from the exact two-loop Higgs mass and the uncertainties of the expansion.
+       */
+      HierarchyError estimateHierarchyError(HierarchyObject& ho, ExactMassMatrixCache& cache) const;
+      /**
+       * 	Compares the expanded with the exact two-loop Higgs mass of a hierarchy candidate.
+       * 	@param ho a HierarchyObject with constant isAlphab, the tree-level mass matrix and the hierarchy candidate.
+       * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+       * 	@return The deviation from the exact two-loop Higgs mass, without the uncertainties of the expansion.
+       */
+      HierarchyError estimateTwoLoopError(HierarchyObject& ho, ExactMassMatrixCache& cache) const;
+      /**
+       * 	Estimates the uncertainties of the expansion of a hierarchy candidate at two- and three-loop level.
+       * 	@param ho a HierarchyObject with constant isAlphab, the tree-level mass matrix and the hierarchy candidate.
+       * 	@param error the error of the hierarchy candidate, whose uncertainties of the expansion are set.
+       * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+       */
+      void estimateExpansionUncertainties(HierarchyObject& ho, HierarchyError& error, ExactMassMatrixCache& cache) const;
+      /**
+       * 	Estimates the uncertainties of the expansion only for those hierarchy candidates which can still have the lowest error.
+       * 	The candidates are visited in ascending order of their two-loop deviation, which is a lower bound of their combined error.
+       * 	@param ho a HierarchyObject with constant isAlphab and the tree-level mass matrix.
+       * 	@param hierarchyErrors the two-loop deviations of all hierarchy candidates in ascending order of the hierarchies.
+       * 	The skipped candidates, which cannot be selected, are removed.
+       * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+       * 	@return The number of skipped estimates of the expansion uncertainty.
+       */
+      int pruneHierarchyCandidates(HierarchyObject& ho, HierarchyErrors& hierarchyErrors, ExactMassMatrixCache& cache) const;
       /**
-       * 	Sorts the eigenvalues of a 2x2 matrix.
-       * 	@param es the EigenSolver object corresponding to the matrix whose eigenvalues should be sorted.
-       * 	@return A sorted vector with the lowest eigenvalue at position 0.
+       * 	Selects the hierarchy candidate with the lowest error and stores it together with its errors in the HierarchyObject.
+       * 	@param ho a HierarchyObject with constant isAlphab.
+       * 	@param hierarchyErrors the errors of all hierarchy candidates in ascending order of the hierarchies.
+       * 	@return An integer which is identified with the suitable hierarchy, or -1 if there are no candidates.
+       */
+      int selectHierarchy(HierarchyObject& ho, const HierarchyErrors& hierarchyErrors) const;
+      /**
+       * 	Calculates the 3-loop mass matrix and all other results for the suitable hierarchy, which has been selected by compareHierarchies.
+       * 	Only the result fields of the HierarchyObject are calculated, where EFT implies DLAMBDA and MDR_SHIFT implies DMH.
+       * 	@param ho a HierarchyObject with constant isAlphab and the suitable hierarchy.
+       * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+       */
+      void calculateDMh3LForSuitableHierarchy(HierarchyObject& ho, ExactMassMatrixCache& cache) const;
+      /**
+       * 	Calculates delta_lambda, its DR' -> MS shifts and its uncertainties due to missing Xt terms for the suitable hierarchy.
+       * 	Requires the H3m contributions to delta_lambda, which are set by calculateHierarchy.
+       * 	@param ho a HierarchyObject with constant isAlphab and the suitable hierarchy.
+       * 	@param calcEFT a bool to calculate the EFT contributions to the Higgs mass as well.
+       */
+      void calculateDLambdaForSuitableHierarchy(HierarchyObject& ho, bool calcEFT) const;
+      /**
+       * 	Calculates the coefficients of the powers of log(mu^2/mst1^2) of the suitable hierarchy at three-loop level.
+       * 	These are the H3m contributions to delta_lambda, which calculateHierarchy sets together with the Higgs mass matrix.
+       * 	@param ho a HierarchyObject with constant isAlphab and the suitable hierarchy.
+       * 	@return The coefficients of Mh^2 @ O(at*as^2) without the SM logarithms.
+       */
+      LogCoefficients<double> calculateLogCoefficients(const HierarchyObject& ho) const;
+      /**
+       * 	Returns the Xt order of the EFT contributions to delta_lambda, which is consistent with the H3m result of a hierarchy.
+       * 	@param hierarchy the key to a hierarchy.
+       * 	@return The Xt order 3 or 4.
+       */
+      int getXtOrder(int hierarchy) const;
+      /**
+       * 	Calculates the hierarchy contributions for a specific hierarchy at a specific loop order
+       * 	together with the terms of the highest order of each truncatable expansion variable.
+       * 	@param ho a HierarchyObject with constant isAlphab.
+       * 	@param oneLoopFlagIn an integer flag which is 0 or 1 in order to add or omit the expanded one-loop results to the returned value, respectivley.
+       * 	@param twoLoopFlagIn an integer flag which is 0 or 1 in order to add or omit the expanded two-loop results to the returned value, respectivley.
+       * 	@param threeLoopFlagIn an integer flag which is 0 or 1 in order to add or omit the expanded three-loop results to the returned value, respectivley.
+       * 	@param flags the expansion depth of each expansion variable.
+       * 	@param truncations if not null, this vector is filled with the mass matrices of the terms which are omitted when
+       * 	truncating the expansion in one of the expansion variables of the hierarchy one order lower.
+       * 	@throws runtime_error Throws a runtime_error if the tree-level is requested in terms of hierarchies.
+       * 	@return The loop corrected Higgs mass matrix which contains the expanded corrections at the given order.
+       */
+      Eigen::Matrix2d calculateHierarchy(himalaya::HierarchyObject& ho, const int oneLoopFlagIn, const int twoLoopFlagIn, const int threeLoopFlagIn,
+                                         const ExpansionFlags& flags, std::vector<Eigen::Matrix2d>* truncations) const;
+      /**
+       * 	Estimates the uncertainty of the expansion at a given order.
+       * 	@param ho a HierarchyObject with constant isAlphab.
+       * 	@param massMatrix the CP-even Higgs mass matrix without the corrections whose uncertainty should be estimated.
+       * 	@param oneLoopFlag an integer flag which is 0 or 1 in order to estimate the uncertainty of the one-loop expansion terms.
+       * 	@param twoLoopFlag an integer flag which is 0 or 1 in order to estimate the uncertainty of the two-loop expansion terms.
+       * 	@param threeLoopFlag an integer flag which is 0 or 1 in order to estimte the uncertainty of the three-loop expansion terms.
+       * 	@param flags the expansion depth of each expansion variable. The expansion in xxMst is always done to the full depth.
+       * 	@return A double which is the estimated uncertainty.
+       */
+      double getExpansionUncertainty(himalaya::HierarchyObject& ho, const Eigen::Matrix2d& massMatrix, const unsigned int oneLoopFlag,
+				     const unsigned int twoLoopFlag, const unsigned int threeLoopFlag, const ExpansionFlags& flags) const;
+      /**
+       * 	Calculates the loop corrected Higgs mass matrix at the order O(alpha_x) using the memoized results of the current calculation.
+       * 	@param ho a HierarchyObject with constant isAlphab.
+       * 	@param shiftOneLoop An integer flag which is 0 or 1 in order to shift the one-loop terms to the MDR scheme.
+       * 	@param shiftTwoLoop An integer flag which is 0 or 1 in order to shift the two-loop terms to the MDR scheme.
+       * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+       * 	@return The loop corrected Higgs mass matrix at the order O(alpha_x).
+       */
+      Eigen::Matrix2d getMt41L(const HierarchyObject& ho, const unsigned int shiftOneLoop, const unsigned int shiftTwoLoop,
+                               ExactMassMatrixCache& cache) const;
+      /**
+       * 	Calculates the loop corrected Higgs mass matrix at the order O(alpha_x*alpha_s) using the memoized results of the current calculation.
+       * 	@param ho a HierarchyObject with constant isAlphab.
+       * 	@param shiftOneLoop An integer flag which is 0 or 1 in order to shift the one-loop terms to the MDR scheme.
+       * 	@param shiftTwoLoop An integer flag which is 0 or 1 in order to shift the two-loop terms to the MDR scheme.
+       * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+       * 	@return The loop corrected Higgs mass matrix at the order O(alpha_x*alpha_s).
+       */
+      Eigen::Matrix2d getMt42L(const HierarchyObject& ho, const unsigned int shiftOneLoop, const unsigned int shiftTwoLoop,
+                               ExactMassMatrixCache& cache) const;
+      /**
+       * 	Calculates the difference of the Higgs mass matrices of the MDR and DR scheme using the memoized results of the current calculation.
+       * 	@param ho a HierarchyObject with constant isAlphab.
+       * 	@param shiftOneLoop a bool to shift the terms at one-loop level.
+       * 	@param shiftTwoLoop a bool to shift the terms at two-loop level.
+       * 	@param cache the memoized exact Higgs mass matrices of the current calculation.
+       * 	@return The loop corrected Higgs mass matrix difference of the MDR and DR scheme at the given order.
        */
-      std::vector<double> sortEigenvalues(const Eigen::EigenSolver<Eigen::Matrix2d>& es);
+      Eigen::Matrix2d calcDRbarToMDRbarShift(const HierarchyObject& ho, const bool shiftOneLoop, const bool shiftTwoLoop,
+                                             ExactMassMatrixCache& cache) const;
       /**
        * 	Shifts the H3m renormalization scheme to DR' scheme
        * 	@param ho a HierarchyObject with constant isAlphab
        * 	@return A matrix which shifts the H3m scheme to the DR' scheme at three-loop level
        *
        */
-      Eigen::Matrix2d shiftH3mToDRbarPrime(const HierarchyObject& ho);
+      Eigen::Matrix2d shiftH3mToDRbarPrime(const HierarchyObject& ho) const;
       /**
        * 	Shifts the H3m renormalization scheme to DR' scheme
        * 	@param ho a HierarchyObject with constant isAlphab
@@ -139,18 +423,17 @@ namespace himalaya{
        * 	@return A double which shifts the H3m scheme to the DR' scheme at three-loop level
        *
        */
-      double shiftH3mToDRbarPrimeMh2(const himalaya::HierarchyObject& ho, int omitLogs);
-      std::map<unsigned int, unsigned int> flagMap{}; ///< A map which holds all hierarchy key value pairs.
+      double shiftH3mToDRbarPrimeMh2(const himalaya::HierarchyObject& ho, int omitLogs) const;
       /**
        * 	Maps a hierarchy to it's mother hierarchy.
        * 	@param hierarchy the key to a hierarchy.
        * 	@throws runtime_error Throws a runtime_error if the given hierarchy is not included.
        * 	@returns The key of the mother hierarchy.
        */
-      int getCorrectHierarchy(const int hierarchy);
+      int getCorrectHierarchy(const int hierarchy) const;
       /**
        * 	Prints out some information about Himalaya.
        */
-      void printInfo();
+      void printInfo() const;
   };
 }	// himalaya
@@ -41,6 +41,14 @@ namespace himalaya{
        * 	@return The relative difference of the exact and expanded Higgs masses at two-loop level at the order O(alpha_x + alpha_x*alpha_s).
        */
       double getRelDiff2L() const;
+      /**
+       * 	@return The number of expansion uncertainty estimates which have been skipped by the pruning of the hierarchy selection.
+       */
+      int getSkippedUncertaintyEstimates() const;
+      /**
+       * 	@return The result fields which have been calculated, a combination of ResultFields flags.
+       */
+      unsigned int getResultFields() const;
       /**
        * 	@param loops an integer which can be 1, 2 or 3.
        * 	@return A double which is the expansion uncertainty for the given loop order.
@@ -125,6 +133,16 @@ namespace himalaya{
        * 	@param relDiff2L the relative difference of the Higgs masses as a double.
        */
       void setRelDiff2L(double relDiff2L);
+      /**
+       * 	Sets the number of expansion uncertainty estimates which have been skipped by the pruning of the hierarchy selection
+       * 	@param skipped the number of skipped estimates.
+       */
+      void setSkippedUncertaintyEstimates(int skipped);
+      /**
+       * 	Sets the result fields which should be calculated
+       * 	@param resultFields a combination of ResultFields flags.
+       */
+      void setResultFields(unsigned int resultFields);
       /**
        * 	Sets the uncertainty of the expansion at a given loop level.
        * 	@param loops the integer value of the corresponding loops. Can be 1, 2 or 3.
@@ -240,6 +258,8 @@ namespace himalaya{
       int renormalizationScheme{RenSchemes::DRBARPRIME};				/**< the renormalization scheme flag */
       double absDiff2L{};								/**< the absolute difference of the two loop Higgs masses */
       double relDiff2L{};								/**< the relative difference of the two loop Higgs masses */
+      int skippedUncertaintyEstimates{};						/**< the number of skipped expansion uncertainty estimates */
+      unsigned int resultFields{ResultFields::ALL};					/**< the calculated result fields */
       std::map<int, double> expUncertainties{};						/**< the map which holds the expansion uncertainties, the keys are the loop order: 1, 2, 3 */
       std::map<int, Eigen::Matrix2d> dMhMap{};						/**< the map which holds all mass matrices at the given loop order */
       Eigen::Matrix2d mdrShift{};							/**< the mass matrix of the difference of the MDR - DR contributions of the order alpha_x + alpha_x*alpha_s */
@@ -0,0 +1,94 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+#pragma once
+
+#include "Hierarchies.hpp"
+#include "Kinematics.hpp"
+#include "SimdPack.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace himalaya {
+
+/**
+ * 	The kinematics of many parameter points as structure of arrays,
+ * 	where the i-th element of each variable belongs to the i-th point.
+ */
+typedef Kinematics<std::vector<double>> KinematicsBatch;
+
+/**
+ * 	Appends a parameter point to a structure of arrays.
+ * 	@param points the kinematics of the points
+ * 	@param point the kinematics of the appended point
+ */
+inline void appendPoint(KinematicsBatch& points, const Kinematics<double>& point) {
+   forEachVariable(points, point, [] (std::vector<double>& v, const double& x) { v.push_back(x); });
+}
+
+/**
+ * 	The three-loop results of a hierarchy for many parameter points as
+ * 	structure of arrays, where the i-th element belongs to the i-th point.
+ */
+struct ThreeLoopBatch {
+   std::vector<double> S1;   ///< diagonal (1, 1) matrix elements
+   std::vector<double> S2;   ///< diagonal (2, 2) matrix elements
+   std::vector<double> S12;  ///< off-diagonal (1, 2) matrix elements
+   std::vector<double> log0; ///< log^0 coefficients of Mh^2 @ O(at*as^2)
+   std::vector<double> log1; ///< log^1 coefficients of Mh^2 @ O(at*as^2)
+   std::vector<double> log2; ///< log^2 coefficients of Mh^2 @ O(at*as^2)
+   std::vector<double> log3; ///< log^3 coefficients of Mh^2 @ O(at*as^2)
+};
+
+/**
+ * 	Evaluates the three-loop matrix elements and the log coefficients of
+ * 	a hierarchy for many parameter points.  The points are gathered into
+ * 	packs of N elements, each pack is evaluated by the kernel at once and
+ * 	the results are scattered back.  The kernels are instantiated for
+ * 	N = 4 and N = 8.
+ * 	@tparam Hierarchy the hierarchy kernel, e.g. H3
+ * 	@tparam N the number of points in a pack
+ * 	@param points the kinematics of the points
+ * 	@param flags the flags for the truncation of expansion variables
+ * 	@param mdrFlag an int 0 for DR and 1 for MDR scheme
+ * 	@return the results of all points
+ */
+template <template <typename> class Hierarchy, int N = SIMD_WIDTH>
+ThreeLoopBatch calculateThreeLoopBatch(const KinematicsBatch& points, const ExpansionFlags& flags, int mdrFlag) {
+   typedef SimdPack<N> Pack;
+
+   const std::size_t n = points.Mst1.size();
+   ThreeLoopBatch results;
+   for (auto* v: {&results.S1, &results.S2, &results.S12, &results.log0, &results.log1, &results.log2, &results.log3}) {
+      v->resize(n);
+   }
+
+   for (std::size_t i = 0; i < n; i += N) {
+      const int m = static_cast<int>(std::min<std::size_t>(n - i, N));
+
+      // gather, the last pack may be incomplete
+      Kinematics<Pack> k;
+      forEachVariable(k, points, [i, m] (Pack& x, const std::vector<double>& v) { x = Pack::load(v.data() + i, m); });
+
+      const Hierarchy<Pack> hierarchy(flags, k, mdrFlag);
+      const auto coefs = hierarchy.calc_coefs_at_as2_no_sm_logs();
+
+      // scatter
+      hierarchy.getS1ThreeLoop().store(results.S1.data() + i, m);
+      hierarchy.getS2ThreeLoop().store(results.S2.data() + i, m);
+      hierarchy.getS12ThreeLoop().store(results.S12.data() + i, m);
+      coefs.log0.store(results.log0.data() + i, m);
+      coefs.log1.store(results.log1.data() + i, m);
+      coefs.log2.store(results.log2.data() + i, m);
+      coefs.log3.store(results.log3.data() + i, m);
+   }
+
+   return results;
+}
+
+} // namespace himalaya
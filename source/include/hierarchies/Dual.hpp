@@ -0,0 +1,98 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+#pragma once
+
+#include <array>
+#include <cmath>
+
+namespace himalaya {
+
+/**
+ * 	A dual number, which holds a value together with its derivatives
+ * 	with respect to N independent variables.
+ *
+ * 	The hierarchy kernels are instantiated with this type for the
+ * 	GradientVariables to evaluate a parameter point together with the
+ * 	gradient of the results in one pass (forward-mode automatic
+ * 	differentiation).  The values are calculated as with double.
+ */
+template <int N>
+class Dual {
+public:
+   static constexpr int size = N; ///< number of derivatives
+
+   /// value and derivatives zero
+   Dual() : v(0.), d() {}
+   /// a constant with value x
+   Dual(double x) : v(x), d() {}
+
+   /**
+    * 	Creates the i-th independent variable.
+    * 	@param x the value
+    * 	@param i the index of the variable
+    * 	@return the dual number with value x and derivative 1 with respect to itself
+    */
+   static Dual variable(double x, int i) {
+      Dual r(x);
+      r.d[i] = 1.;
+      return r;
+   }
+
+   /// returns the value
+   double value() const { return v; }
+   /// returns the derivative with respect to the i-th variable
+   double derivative(int i) const { return d[i]; }
+   /// returns the derivatives with respect to all variables
+   const std::array<double, N>& gradient() const { return d; }
+   /// sets the derivative with respect to the i-th variable
+   void setDerivative(int i, double x) { d[i] = x; }
+
+   Dual& operator+=(const Dual& x) { v += x.v; for (int i = 0; i < N; i++) { d[i] += x.d[i]; } return *this; }
+   Dual& operator-=(const Dual& x) { v -= x.v; for (int i = 0; i < N; i++) { d[i] -= x.d[i]; } return *this; }
+   Dual& operator*=(const Dual& x) {
+      for (int i = 0; i < N; i++) { d[i] = d[i] * x.v + v * x.d[i]; }
+      v *= x.v;
+      return *this;
+   }
+   Dual& operator/=(const Dual& x) {
+      const double inv = 1. / x.v;
+      v /= x.v;
+      for (int i = 0; i < N; i++) { d[i] = (d[i] - v * x.d[i]) * inv; }
+      return *this;
+   }
+
+   friend Dual operator+(const Dual& x) { return x; }
+   friend Dual operator-(const Dual& x) { return x.chain(-x.v, -1.); }
+   friend Dual operator+(const Dual& x, const Dual& y) { Dual r(x); return r += y; }
+   friend Dual operator-(const Dual& x, const Dual& y) { Dual r(x); return r -= y; }
+   friend Dual operator*(const Dual& x, const Dual& y) { Dual r(x); return r *= y; }
+   friend Dual operator/(const Dual& x, const Dual& y) { Dual r(x); return r /= y; }
+
+   friend Dual cos(const Dual& x) { return x.chain(std::cos(x.v), -std::sin(x.v)); }
+   friend Dual exp(const Dual& x) { const double e = std::exp(x.v); return x.chain(e, e); }
+   friend Dual log(const Dual& x) { return x.chain(std::log(x.v), 1. / x.v); }
+   friend Dual sin(const Dual& x) { return x.chain(std::sin(x.v), std::cos(x.v)); }
+   friend Dual sqrt(const Dual& x) { const double s = std::sqrt(x.v); return x.chain(s, 0.5 / s); }
+   friend Dual tan(const Dual& x) { const double t = std::tan(x.v); return x.chain(t, 1. + t * t); }
+   friend Dual atan(const Dual& x) { return x.chain(std::atan(x.v), 1. / (1. + x.v * x.v)); }
+
+private:
+   double v;               ///< value
+   std::array<double, N> d; ///< derivatives
+
+   /// returns f(x) with the value fx and the derivative dfx = f'(x)
+   Dual chain(double fx, double dfx) const {
+      Dual r(fx);
+      for (int i = 0; i < N; i++) {
+         r.d[i] = dfx * d[i];
+      }
+      return r;
+   }
+};
+
+} // namespace himalaya
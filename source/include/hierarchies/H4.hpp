@@ -7,62 +7,101 @@
 
 #pragma once
 
-#include <map>
+#include "Hierarchies.hpp"
+#include "Kinematics.hpp"
+#include "LogCoefficients.hpp"
+#include <array>
 
 namespace himalaya{
    
+   template <typename T>
    class H4{
    public:
       /**
        * 	Constructor
-       * 	@param flagMap the flagMap for the truncation of expansion variables
-       * 	@param Al4p a double alpha_s/4/Pi
-       * 	@param At a double tri-linear breaking term
-       * 	@param beta a double which is the mixing angle beta
-       * 	@param lmMt a double log((<renormalization scale> / Mt)^2)
-       * 	@param lmMsq a double log((<renormalization scale> / Msq)^2)
-       * 	@param Mt a double top/bottom quark mass
-       * 	@param Msusy a double (Mst1 + Mst2 + Mgl) / 3.
-       * 	@param Msq a double the average squark mass w/o the top squark
+       * 	@param flags the flags for the truncation of expansion variables
+       * 	@param kinematics the masses, mass differences and logarithms of the parameter point
        * 	@param mdrFlag an int 0 for DR and 1 for MDR scheme
-       * 	@param oneLoopFlag an int flag to consider the one-loop expansion terms
-       * 	@param twoLoopFlag an int flag to consider the two-loop expansion terms
-       * 	@param threeLoopFlag an int flag to consider the three-loop expansion terms
        */
-      H4(const std::map<unsigned int, unsigned int>& flagMap, double Al4p, double At, double beta,
-		 double lmMt, double lmMsq, double lmMsusy, double Mt, double Msusy, double Msq,
-		 int mdrFlag, int oneLoopFlag, int twoLoopFlag, int threeLoopFlag);
+      H4(const ExpansionFlags& flags, const Kinematics<T>& kinematics, int mdrFlag);
       /**
-       * 	@return The diagonal (1, 1) matrix element of the Higgs mass matrix as a double for the hierarchy 'H4'
+       * 	@return The diagonal (1, 1) matrix element of the Higgs mass matrix at the one-loop order for the hierarchy 'H4'
        */
-      double getS1() const;
+      T getS1OneLoop() const;
       /**
-       * 	@return The diagonal (2, 2) matrix element of the Higgs mass matrix as a double for the hierarchy 'H4'
+       * 	@return The terms of the diagonal (1, 1) matrix element at the one-loop order for the hierarchy 'H4' which are omitted when truncating the expansion in xxAt, xxlmMsusy, xxMsq or xxMsusy, respectively
        */
-      double getS2() const;
+      std::array<T, 4> getS1OneLoopTruncations() const;
       /**
-       * 	@return The off-diagonal (1, 2) = (2, 1) matrix element of the Higgs mass matrix as a double for the hierarchy 'H4'
+       * 	@return The diagonal (1, 1) matrix element of the Higgs mass matrix at the two-loop order for the hierarchy 'H4'
        */
-      double getS12() const;
+      T getS1TwoLoop() const;
       /**
-       * 	@return returns the susy log^0 term of Mh^2 @ O(at*as^2) without any log(mu^2) terms normalized to DO (H3m*12/Mt^4/Sbeta^2)
+       * 	@return The terms of the diagonal (1, 1) matrix element at the two-loop order for the hierarchy 'H4' which are omitted when truncating the expansion in xxAt, xxlmMsusy, xxMsq or xxMsusy, respectively
        */
-      double calc_coef_at_as2_no_sm_logs_log0() const;
+      std::array<T, 4> getS1TwoLoopTruncations() const;
       /**
-       * 	@return returns the susy log^1 term of Mh^2 @ O(at*as^2) without any log(mu^2) terms normalized to DO (H3m*12/Mt^4/Sbeta^2)
+       * 	@return The diagonal (1, 1) matrix element of the Higgs mass matrix at the three-loop order for the hierarchy 'H4'
        */
-      double calc_coef_at_as2_no_sm_logs_log1() const;
+      T getS1ThreeLoop() const;
       /**
-       * 	@return returns the susy log^2 term of Mh^2 @ O(at*as^2) without any log(mu^2) terms normalized to DO (H3m*12/Mt^4/Sbeta^2)
+       * 	@return The terms of the diagonal (1, 1) matrix element at the three-loop order for the hierarchy 'H4' which are omitted when truncating the expansion in xxAt, xxlmMsusy, xxMsq or xxMsusy, respectively
        */
-      double calc_coef_at_as2_no_sm_logs_log2() const;
+      std::array<T, 4> getS1ThreeLoopTruncations() const;
       /**
-       * 	@return returns the susy log^3 term of Mh^2 @ O(at*as^2) without any log(mu^2) terms normalized to DO (H3m*12/Mt^4/Sbeta^2)
+       * 	@return The diagonal (2, 2) matrix element of the Higgs mass matrix at the one-loop order for the hierarchy 'H4'
        */
-      double calc_coef_at_as2_no_sm_logs_log3() const;
+      T getS2OneLoop() const;
+      /**
+       * 	@return The terms of the diagonal (2, 2) matrix element at the one-loop order for the hierarchy 'H4' which are omitted when truncating the expansion in xxAt, xxlmMsusy, xxMsq or xxMsusy, respectively
+       */
+      std::array<T, 4> getS2OneLoopTruncations() const;
+      /**
+       * 	@return The diagonal (2, 2) matrix element of the Higgs mass matrix at the two-loop order for the hierarchy 'H4'
+       */
+      T getS2TwoLoop() const;
+      /**
+       * 	@return The terms of the diagonal (2, 2) matrix element at the two-loop order for the hierarchy 'H4' which are omitted when truncating the expansion in xxAt, xxlmMsusy, xxMsq or xxMsusy, respectively
+       */
+      std::array<T, 4> getS2TwoLoopTruncations() const;
+      /**
+       * 	@return The diagonal (2, 2) matrix element of the Higgs mass matrix at the three-loop order for the hierarchy 'H4'
+       */
+      T getS2ThreeLoop() const;
+      /**
+       * 	@return The terms of the diagonal (2, 2) matrix element at the three-loop order for the hierarchy 'H4' which are omitted when truncating the expansion in xxAt, xxlmMsusy, xxMsq or xxMsusy, respectively
+       */
+      std::array<T, 4> getS2ThreeLoopTruncations() const;
+      /**
+       * 	@return The off-diagonal (1, 2) = (2, 1) matrix element of the Higgs mass matrix at the one-loop order for the hierarchy 'H4'
+       */
+      T getS12OneLoop() const;
+      /**
+       * 	@return The terms of the off-diagonal (1, 2) = (2, 1) matrix element at the one-loop order for the hierarchy 'H4' which are omitted when truncating the expansion in xxAt, xxlmMsusy, xxMsq or xxMsusy, respectively
+       */
+      std::array<T, 4> getS12OneLoopTruncations() const;
+      /**
+       * 	@return The off-diagonal (1, 2) = (2, 1) matrix element of the Higgs mass matrix at the two-loop order for the hierarchy 'H4'
+       */
+      T getS12TwoLoop() const;
+      /**
+       * 	@return The terms of the off-diagonal (1, 2) = (2, 1) matrix element at the two-loop order for the hierarchy 'H4' which are omitted when truncating the expansion in xxAt, xxlmMsusy, xxMsq or xxMsusy, respectively
+       */
+      std::array<T, 4> getS12TwoLoopTruncations() const;
+      /**
+       * 	@return The off-diagonal (1, 2) = (2, 1) matrix element of the Higgs mass matrix at the three-loop order for the hierarchy 'H4'
+       */
+      T getS12ThreeLoop() const;
+      /**
+       * 	@return The terms of the off-diagonal (1, 2) = (2, 1) matrix element at the three-loop order for the hierarchy 'H4' which are omitted when truncating the expansion in xxAt, xxlmMsusy, xxMsq or xxMsusy, respectively
+       */
+      std::array<T, 4> getS12ThreeLoopTruncations() const;
+      /**
+       * 	@return returns the susy log^0, log^1, log^2 and log^3 terms of Mh^2 @ O(at*as^2) without any log(mu^2) terms normalized to DO (H3m*12/Mt^4/Sbeta^2)
+       */
+      LogCoefficients<T> calc_coefs_at_as2_no_sm_logs() const;
    private:
-      double At{}, lmMt{}, lmMsq{}, lmMsusy{}, Msusy{}, Mt{}, Msq{}, Cbeta{}, Sbeta{}, Al4p{}; /**< common variables */
-      double shiftst1{}, shiftst2{}, shiftst3{}, xAt{}, xMsq{}, xlmMsusy{}, xMsusy{}; /**< MDR and truncation flags */
-      int oneLoopFlag{}, twoLoopFlag{}, threeLoopFlag{}; /**< loop flags */
+      T At{}, lmMt{}, lmMsq{}, lmMsusy{}, Msusy{}, Mt{}, Msq{}, Cbeta{}, Sbeta{}, Al4p{}, lMsqMsusy{}; /**< common variables */
+      T shiftst1{}, shiftst2{}, shiftst3{}, xAt{}, xMsq{}, xlmMsusy{}, xMsusy{}; /**< MDR and truncation flags */
    };
 }	// himalaya
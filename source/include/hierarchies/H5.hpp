@@ -7,69 +7,102 @@
 
 #pragma once
 
-#include <map>
+#include "Hierarchies.hpp"
+#include "Kinematics.hpp"
+#include "LogCoefficients.hpp"
+#include <array>
 
 namespace himalaya{
    
+   template <typename T>
    class H5{
    public:
       /**
        * 	Constructor
-       * 	@param flagMap the flagMap for the truncation of expansion variables
-       * 	@param Al4p a double alpha_s/4/Pi
-       * 	@param beta a double which is the mixing angle beta
-       * 	@param Dmglst1 a double Mgl - Mst1
-       * 	@param lmMt a double log((<renormalization scale> / Mt)^2)
-       * 	@param lmMst1 a double log((<renormalization scale> / Mst1)^2)
-       * 	@param lmMst2 a double log((<renormalization scale> / Mst2)^2)
-       * 	@param lmMsq a double log((<renormalization scale> / Msq)^2)
-       * 	@param Mt a double top/bottom quark mass
-       * 	@param Mst1 a double stop 1 mass
-       * 	@param Mst2 a double stop 2 mass
-       * 	@param Msq a double average squark mass w/o the stop quark
-       * 	@param MuSUSY a double mu parameter
-       * 	@param s2t a double 2 times the sine of the stop/sbottom quark mixing angle
+       * 	@param flags the flags for the truncation of expansion variables
+       * 	@param kinematics the masses, mass differences and logarithms of the parameter point
        * 	@param mdrFlag an int 0 for DR and 1 for MDR scheme
-       * 	@param oneLoopFlag an int flag to consider the one-loop expansion terms
-       * 	@param twoLoopFlag an int flag to consider the two-loop expansion terms
-       * 	@param threeLoopFlag an int flag to consider the three-loop expansion terms
        */
-      H5(const std::map<unsigned int, unsigned int>& flagMap, double Al4p, double beta, double Dmglst1,
-		 double lmMt, double lmMst1, double lmMst2, double lmMsq, double Mt, double Mst1,
-		 double Mst2, double Msq, double MuSUSY,
-		 double s2t,
-		 int mdrFlag, int oneLoopFlag, int twoLoopFlag, int threeLoopFlag);
+      H5(const ExpansionFlags& flags, const Kinematics<T>& kinematics, int mdrFlag);
       /**
-       * 	@return The diagonal (1, 1) matrix element of the Higgs mass matrix as a double for the hierarchy 'H5'
+       * 	@return The diagonal (1, 1) matrix element of the Higgs mass matrix at the one-loop order for the hierarchy 'H5'
        */
-      double getS1() const;
+      T getS1OneLoop() const;
       /**
-       * 	@return The diagonal (2, 2) matrix element of the Higgs mass matrix as a double for the hierarchy 'H5'
+       * 	@return The terms of the diagonal (1, 1) matrix element at the one-loop order for the hierarchy 'H5' which are omitted when truncating the expansion in xxDmglst1 or xxMsq, respectively
        */
-      double getS2() const;
+      std::array<T, 2> getS1OneLoopTruncations() const;
       /**
-       * 	@return The off-diagonal (1, 2) = (2, 1) matrix element of the Higgs mass matrix as a double for the hierarchy 'H5'
+       * 	@return The diagonal (1, 1) matrix element of the Higgs mass matrix at the two-loop order for the hierarchy 'H5'
        */
-      double getS12() const;
+      T getS1TwoLoop() const;
       /**
-       * 	@return returns the susy log^0 term of Mh^2 @ O(at*as^2) without any log(mu^2) terms normalized to DO (H3m*12/Mt^4/Sbeta^2)
+       * 	@return The terms of the diagonal (1, 1) matrix element at the two-loop order for the hierarchy 'H5' which are omitted when truncating the expansion in xxDmglst1 or xxMsq, respectively
        */
-      double calc_coef_at_as2_no_sm_logs_log0() const;
+      std::array<T, 2> getS1TwoLoopTruncations() const;
       /**
-       * 	@return returns the susy log^1 term of Mh^2 @ O(at*as^2) without any log(mu^2) terms normalized to DO (H3m*12/Mt^4/Sbeta^2)
+       * 	@return The diagonal (1, 1) matrix element of the Higgs mass matrix at the three-loop order for the hierarchy 'H5'
        */
-      double calc_coef_at_as2_no_sm_logs_log1() const;
+      T getS1ThreeLoop() const;
       /**
-       * 	@return returns the susy log^2 term of Mh^2 @ O(at*as^2) without any log(mu^2) terms normalized to DO (H3m*12/Mt^4/Sbeta^2)
+       * 	@return The terms of the diagonal (1, 1) matrix element at the three-loop order for the hierarchy 'H5' which are omitted when truncating the expansion in xxDmglst1 or xxMsq, respectively
        */
-      double calc_coef_at_as2_no_sm_logs_log2() const;
+      std::array<T, 2> getS1ThreeLoopTruncations() const;
       /**
-       * 	@return returns the susy log^3 term of Mh^2 @ O(at*as^2) without any log(mu^2) terms normalized to DO (H3m*12/Mt^4/Sbeta^2)
+       * 	@return The diagonal (2, 2) matrix element of the Higgs mass matrix at the one-loop order for the hierarchy 'H5'
        */
-      double calc_coef_at_as2_no_sm_logs_log3() const;
+      T getS2OneLoop() const;
+      /**
+       * 	@return The terms of the diagonal (2, 2) matrix element at the one-loop order for the hierarchy 'H5' which are omitted when truncating the expansion in xxDmglst1 or xxMsq, respectively
+       */
+      std::array<T, 2> getS2OneLoopTruncations() const;
+      /**
+       * 	@return The diagonal (2, 2) matrix element of the Higgs mass matrix at the two-loop order for the hierarchy 'H5'
+       */
+      T getS2TwoLoop() const;
+      /**
+       * 	@return The terms of the diagonal (2, 2) matrix element at the two-loop order for the hierarchy 'H5' which are omitted when truncating the expansion in xxDmglst1 or xxMsq, respectively
+       */
+      std::array<T, 2> getS2TwoLoopTruncations() const;
+      /**
+       * 	@return The diagonal (2, 2) matrix element of the Higgs mass matrix at the three-loop order for the hierarchy 'H5'
+       */
+      T getS2ThreeLoop() const;
+      /**
+       * 	@return The terms of the diagonal (2, 2) matrix element at the three-loop order for the hierarchy 'H5' which are omitted when truncating the expansion in xxDmglst1 or xxMsq, respectively
+       */
+      std::array<T, 2> getS2ThreeLoopTruncations() const;
+      /**
+       * 	@return The off-diagonal (1, 2) = (2, 1) matrix element of the Higgs mass matrix at the one-loop order for the hierarchy 'H5'
+       */
+      T getS12OneLoop() const;
+      /**
+       * 	@return The terms of the off-diagonal (1, 2) = (2, 1) matrix element at the one-loop order for the hierarchy 'H5' which are omitted when truncating the expansion in xxDmglst1 or xxMsq, respectively
+       */
+      std::array<T, 2> getS12OneLoopTruncations() const;
+      /**
+       * 	@return The off-diagonal (1, 2) = (2, 1) matrix element of the Higgs mass matrix at the two-loop order for the hierarchy 'H5'
+       */
+      T getS12TwoLoop() const;
+      /**
+       * 	@return The terms of the off-diagonal (1, 2) = (2, 1) matrix element at the two-loop order for the hierarchy 'H5' which are omitted when truncating the expansion in xxDmglst1 or xxMsq, respectively
+       */
+      std::array<T, 2> getS12TwoLoopTruncations() const;
+      /**
+       * 	@return The off-diagonal (1, 2) = (2, 1) matrix element of the Higgs mass matrix at the three-loop order for the hierarchy 'H5'
+       */
+      T getS12ThreeLoop() const;
+      /**
+       * 	@return The terms of the off-diagonal (1, 2) = (2, 1) matrix element at the three-loop order for the hierarchy 'H5' which are omitted when truncating the expansion in xxDmglst1 or xxMsq, respectively
+       */
+      std::array<T, 2> getS12ThreeLoopTruncations() const;
+      /**
+       * 	@return returns the susy log^0, log^1, log^2 and log^3 terms of Mh^2 @ O(at*as^2) without any log(mu^2) terms normalized to DO (H3m*12/Mt^4/Sbeta^2)
+       */
+      LogCoefficients<T> calc_coefs_at_as2_no_sm_logs() const;
    private:
-      double Dmglst1{}, lmMt{}, lmMst1{}, lmMst2{}, lmMsq{}, Mt{}, Mst1{}, Mst2{}, Msq{}, MuSUSY{}, s2t{}, Tbeta{}, Sbeta{}, Cbeta{}, Al4p{}; /**< common variables */
+      T Dmglst1{}, lmMt{}, lmMst1{}, lmMst2{}, lmMsq{}, Mt{}, Mst1{}, Mst2{}, Msq{}, MuSUSY{}, s2t{}, Tbeta{}, Sbeta{}, Cbeta{}, Al4p{}, lMst1Mst2{}, lMst1Msq{}; /**< common variables */
+      std::array<T, 15> powMst1{}, powMst2{}; /**< powers of the stop/sbottom masses */
       int shiftst1{}, shiftst2{}, shiftst3{}, xDmglst1{}, xMsq{}; /**< MDR and truncation flags */
-      int oneLoopFlag{}, twoLoopFlag{}, threeLoopFlag{}; /**< loop flags */
    };
 }	// himalaya
@@ -0,0 +1,138 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+#pragma once
+
+#include "Utils.hpp"
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace himalaya {
+
+/**
+ * 	The masses, mass differences and logarithms of a parameter point,
+ * 	which are calculated once and shared by all hierarchies.
+ *
+ * 	The powers of the stop/sbottom masses occur in almost every term of
+ * 	the kernels and in all their matrix elements.  They are tabulated
+ * 	once per point, where powMst1[n] holds Mst1^n as given by the pown
+ * 	functions, such that the results are unchanged.
+ */
+template <typename T>
+struct Kinematics {
+   T Al4p{};      ///< alpha_s/(4*Pi)
+   T Tbeta{};     ///< tan(beta)
+   T Sbeta{};     ///< sin(beta)
+   T Cbeta{};     ///< cos(beta)
+   T scale{};     ///< renormalization scale
+   T MuSUSY{};    ///< mu parameter
+   T At{};        ///< trilinear top/bottom coupling
+   T Mt{};        ///< top/bottom quark mass
+   T s2t{};       ///< 2 times the sine of the stop/sbottom quark mixing angle
+   T Mgl{};       ///< gluino mass
+   T Msq{};       ///< mean light squark mass
+   T Mst1{};      ///< stop/sbottom 1 mass
+   T Mst2{};      ///< stop/sbottom 2 mass
+   T Msusy{};     ///< (Mst1 + Mst2 + Mgl) / 3
+   T Dmglst1{};   ///< Mgl - Mst1
+   T Dmglst2{};   ///< Mgl - Mst2
+   T Dmst12{};    ///< Mst1^2 - Mst2^2
+   T Dmsqst1{};   ///< Msq^2 - Mst1^2
+   T Dmsqst2{};   ///< Msq - Mst2
+   T lmMt{};      ///< log((renormalization scale / Mt)^2)
+   T lmMgl{};     ///< log((renormalization scale / Mgl)^2)
+   T lmMsq{};     ///< log((renormalization scale / Msq)^2)
+   T lmMst1{};    ///< log((renormalization scale / Mst1)^2)
+   T lmMst2{};    ///< log((renormalization scale / Mst2)^2)
+   T lmMsusy{};   ///< log((renormalization scale / Msusy)^2)
+   T lMst1Mst2{}; ///< log(Mst1^2 / Mst2^2)
+   T lMst1Msq{};  ///< log(Mst1^2 / Msq^2)
+   T lMst1Mgl{};  ///< log(Mst1^2 / Mgl^2)
+   T lMsqMsusy{}; ///< log(Msq^2 / Msusy^2)
+   std::array<T, 15> powMst1{}; ///< powers Mst1^n for n = 0, ..., 14
+   std::array<T, 15> powMst2{}; ///< powers Mst2^n for n = 0, ..., 14
+
+   /**
+    * 	Sets the stop/sbottom masses and calculates the mass differences
+    * 	and logarithms which depend on them.
+    * 	@param Mst1_ stop/sbottom 1 mass
+    * 	@param Mst2_ stop/sbottom 2 mass
+    */
+   void setStopMasses(const T& Mst1_, const T& Mst2_) {
+      using std::log;
+      Mst1 = Mst1_;
+      Mst2 = Mst2_;
+      Msusy = (Mst1 + Mst2 + Mgl) / 3.;
+      Dmglst1 = Mgl - Mst1;
+      Dmglst2 = Mgl - Mst2;
+      Dmst12 = pow2(Mst1) - pow2(Mst2);
+      Dmsqst1 = pow2(Msq) - pow2(Mst1);
+      Dmsqst2 = Msq - Mst2;
+      lmMst1 = log(pow2(scale / Mst1));
+      lmMst2 = log(pow2(scale / Mst2));
+      lmMsusy = log(pow2(scale / Msusy));
+      lMst1Mst2 = log(pow2(Mst1)/pow2(Mst2));
+      lMst1Msq = log(pow2(Mst1)/pow2(Msq));
+      lMst1Mgl = log(pow2(Mst1)/pow2(Mgl));
+      lMsqMsusy = log(pow2(Msq)/pow2(Msusy));
+      tabulatePowers(Mst1, powMst1);
+      tabulatePowers(Mst2, powMst2);
+   }
+
+private:
+   static void tabulatePowers(const T& x, std::array<T, 15>& p) {
+      p = {{T(1.), x, pow2(x), pow3(x), pow4(x), pow5(x), pow6(x), pow7(x), pow8(x),
+            pow9(x), power10(x), pow11(x), pow12(x), pow13(x), pow14(x)}};
+   }
+};
+
+/**
+ * 	Calls f(a.x, b.x) for each variable x of two kinematics, which may
+ * 	be of different types, e.g. to gather or scatter packs of points.
+ * 	@param a the first kinematics
+ * 	@param b the second kinematics
+ * 	@param f the function object called for each pair of variables
+ */
+template <typename A, typename B, typename F>
+void forEachVariable(A& a, B& b, F f) {
+   f(a.Al4p, b.Al4p);
+   f(a.Tbeta, b.Tbeta);
+   f(a.Sbeta, b.Sbeta);
+   f(a.Cbeta, b.Cbeta);
+   f(a.scale, b.scale);
+   f(a.MuSUSY, b.MuSUSY);
+   f(a.At, b.At);
+   f(a.Mt, b.Mt);
+   f(a.s2t, b.s2t);
+   f(a.Mgl, b.Mgl);
+   f(a.Msq, b.Msq);
+   f(a.Mst1, b.Mst1);
+   f(a.Mst2, b.Mst2);
+   f(a.Msusy, b.Msusy);
+   f(a.Dmglst1, b.Dmglst1);
+   f(a.Dmglst2, b.Dmglst2);
+   f(a.Dmst12, b.Dmst12);
+   f(a.Dmsqst1, b.Dmsqst1);
+   f(a.Dmsqst2, b.Dmsqst2);
+   f(a.lmMt, b.lmMt);
+   f(a.lmMgl, b.lmMgl);
+   f(a.lmMsq, b.lmMsq);
+   f(a.lmMst1, b.lmMst1);
+   f(a.lmMst2, b.lmMst2);
+   f(a.lmMsusy, b.lmMsusy);
+   f(a.lMst1Mst2, b.lMst1Mst2);
+   f(a.lMst1Msq, b.lMst1Msq);
+   f(a.lMst1Mgl, b.lMst1Mgl);
+   f(a.lMsqMsusy, b.lMsqMsusy);
+   for (std::size_t n = 0; n < a.powMst1.size(); n++) {
+      f(a.powMst1[n], b.powMst1[n]);
+      f(a.powMst2[n], b.powMst2[n]);
+   }
+}
+
+} // namespace himalaya
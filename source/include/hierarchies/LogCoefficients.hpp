@@ -0,0 +1,71 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+#pragma once
+
+#include "Utils.hpp"
+#include <array>
+
+namespace himalaya {
+
+/**
+ * 	The coefficients of the powers of log(mu^2/mst1^2) in the susy
+ * 	terms of Mh^2 @ O(at*as^2), which are evaluated by the hierarchies
+ * 	in one go.
+ */
+template <typename T>
+struct LogCoefficients {
+   T log0{}; ///< coefficient of log^0
+   T log1{}; ///< coefficient of log^1
+   T log2{}; ///< coefficient of log^2
+   T log3{}; ///< coefficient of log^3
+
+   /**
+    * 	Evaluates the polynomial in the logarithm.
+    * 	@param lmMst1 log((renormalization scale / Mst1)^2)
+    * 	@return the sum of the coefficients times the powers of lmMst1
+    */
+   template <typename L>
+   T eval(const L& lmMst1) const {
+      return log0 + lmMst1 * log1 + pow2(lmMst1) * log2 + pow3(lmMst1) * log3;
+   }
+};
+
+/**
+ * 	Returns the i-th value of log(mu^2/mst1^2), at which
+ * 	interpolateLogCoefficients expects the values of a polynomial.
+ * 	@param i the index of the node, 0 <= i < 4
+ */
+inline double getLogNode(int i) {
+   return i - 1.5;
+}
+
+/**
+ * 	Determines the coefficients of a polynomial of at most third degree
+ * 	in log(mu^2/mst1^2) from its values at the nodes getLogNode(i).
+ * 	@param f the values of the polynomial at the nodes
+ * 	@return the coefficients of the polynomial
+ */
+template <typename T>
+LogCoefficients<T> interpolateLogCoefficients(const std::array<T, 4>& f) {
+   // the nodes are symmetric around 0, such that the even and odd
+   // powers decouple
+   const T even1 = 0.5 * (f[1] + f[2]);
+   const T even3 = 0.5 * (f[0] + f[3]);
+   const T odd1 = 0.5 * (f[2] - f[1]);
+   const T odd3 = 0.5 * (f[3] - f[0]);
+
+   LogCoefficients<T> c;
+   c.log2 = 0.5 * (even3 - even1);
+   c.log0 = even1 - 0.25 * c.log2;
+   c.log3 = (odd3 - 3. * odd1) / 3.;
+   c.log1 = 2. * odd1 - 0.25 * c.log3;
+
+   return c;
+}
+
+} // namespace himalaya
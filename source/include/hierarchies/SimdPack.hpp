@@ -0,0 +1,166 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+#pragma once
+
+#include <cmath>
+
+namespace himalaya {
+
+/**
+ * 	The preferred number of doubles in a SIMD register.  The hierarchy
+ * 	kernels are instantiated in the library for the widths 4 and 8, such
+ * 	that both are available regardless of the flags a client is compiled
+ * 	with.
+ */
+#if defined(__AVX512F__)
+constexpr int SIMD_WIDTH = 8;
+#else
+constexpr int SIMD_WIDTH = 4;
+#endif
+
+/**
+ * 	The storage of N doubles with element-wise arithmetic operations.
+ * 	This generic version is used if no vector extension is available.
+ */
+template <int N>
+struct SimdVector {
+   struct type {
+      double e[N];
+      double& operator[](int i) { return e[i]; }
+      double operator[](int i) const { return e[i]; }
+      type operator-() const { type r; for (int i = 0; i < N; i++) { r.e[i] = -e[i]; } return r; }
+      type& operator+=(const type& x) { for (int i = 0; i < N; i++) { e[i] += x.e[i]; } return *this; }
+      type& operator-=(const type& x) { for (int i = 0; i < N; i++) { e[i] -= x.e[i]; } return *this; }
+      type& operator*=(const type& x) { for (int i = 0; i < N; i++) { e[i] *= x.e[i]; } return *this; }
+      type& operator/=(const type& x) { for (int i = 0; i < N; i++) { e[i] /= x.e[i]; } return *this; }
+   };
+};
+
+#if defined(__GNUC__)
+// GCC and Clang vector extensions for the common SIMD register sizes.  Their
+// layout does not depend on the instruction set, but passing them by value
+// does, so the packs are passed by reference.
+template <> struct SimdVector<2> { typedef double type __attribute__((vector_size(2 * sizeof(double)))); };
+template <> struct SimdVector<4> { typedef double type __attribute__((vector_size(4 * sizeof(double)))); };
+template <> struct SimdVector<8> { typedef double type __attribute__((vector_size(8 * sizeof(double)))); };
+#endif
+
+/**
+ * 	A pack of N doubles, on which all arithmetic operations and
+ * 	elementary functions act element-wise.
+ *
+ * 	The hierarchy kernels are instantiated with this type to evaluate
+ * 	N parameter points at once, where the points are given as
+ * 	structure of arrays.  With GCC and Clang the arithmetic operations
+ * 	are mapped to SIMD instructions (AVX2 or AVX-512 when compiled with
+ * 	-march=native).  The elementary functions are evaluated element by
+ * 	element.
+ */
+template <int N>
+class SimdPack {
+public:
+   static constexpr int size = N; ///< number of elements
+
+   /// all elements zero
+   SimdPack() : v() {}
+   /// all elements equal to x
+   SimdPack(double x) { broadcast(x); }
+
+   /**
+    * 	Loads n consecutive values.  The elements beyond n are set to
+    * 	the first value, such that they remain in the valid domain.
+    * 	@param p pointer to the values
+    * 	@param n number of values, at most N
+    * 	@return the pack of the values
+    */
+   static SimdPack load(const double* p, int n = N) {
+      SimdPack r;
+      for (int i = 0; i < N; i++) {
+         r.v[i] = p[i < n ? i : 0];
+      }
+      return r;
+   }
+
+   /**
+    * 	Stores the first n elements.
+    * 	@param p pointer to the destination
+    * 	@param n number of values, at most N
+    */
+   void store(double* p, int n = N) const {
+      for (int i = 0; i < n; i++) {
+         p[i] = v[i];
+      }
+   }
+
+   /// returns the i-th element
+   double operator[](int i) const { return v[i]; }
+
+   SimdPack& operator+=(const SimdPack& x) { v += x.v; return *this; }
+   SimdPack& operator-=(const SimdPack& x) { v -= x.v; return *this; }
+   SimdPack& operator*=(const SimdPack& x) { v *= x.v; return *this; }
+   SimdPack& operator/=(const SimdPack& x) { v /= x.v; return *this; }
+
+   friend SimdPack operator+(const SimdPack& x) { return x; }
+   friend SimdPack operator-(const SimdPack& x) { SimdPack r; r.v = -x.v; return r; }
+   friend SimdPack operator+(const SimdPack& x, const SimdPack& y) { SimdPack r(x); return r += y; }
+   friend SimdPack operator-(const SimdPack& x, const SimdPack& y) { SimdPack r(x); return r -= y; }
+   friend SimdPack operator*(const SimdPack& x, const SimdPack& y) { SimdPack r(x); return r *= y; }
+   friend SimdPack operator/(const SimdPack& x, const SimdPack& y) { SimdPack r(x); return r /= y; }
+
+   friend SimdPack cos(const SimdPack& x) { return x.apply([] (double a) { return std::cos(a); }); }
+   friend SimdPack exp(const SimdPack& x) { return x.apply([] (double a) { return std::exp(a); }); }
+   friend SimdPack floor(const SimdPack& x) { return x.apply([] (double a) { return std::floor(a); }); }
+   friend SimdPack log(const SimdPack& x) { return x.apply([] (double a) { return std::log(a); }); }
+   friend SimdPack log1p(const SimdPack& x) { return x.apply([] (double a) { return std::log1p(a); }); }
+   friend SimdPack sin(const SimdPack& x) { return x.apply([] (double a) { return std::sin(a); }); }
+   friend SimdPack sqrt(const SimdPack& x) { return x.apply([] (double a) { return std::sqrt(a); }); }
+   friend SimdPack tan(const SimdPack& x) { return x.apply([] (double a) { return std::tan(a); }); }
+
+   /**
+    * 	Selects element-wise without branches.
+    * 	@return the elements of a where x < y and the ones of b elsewhere
+    */
+   friend SimdPack selectLess(const SimdPack& x, const SimdPack& y, const SimdPack& a, const SimdPack& b) {
+      SimdPack r;
+      for (int i = 0; i < N; i++) {
+         r.v[i] = x.v[i] < y.v[i] ? a.v[i] : b.v[i];
+      }
+      return r;
+   }
+
+private:
+   typedef typename SimdVector<N>::type Vector;
+
+   Vector v; ///< elements
+
+   void broadcast(double x) {
+      for (int i = 0; i < N; i++) {
+         v[i] = x;
+      }
+   }
+
+   template <typename F>
+   SimdPack apply(F f) const {
+      SimdPack r;
+      for (int i = 0; i < N; i++) {
+         r.v[i] = f(v[i]);
+      }
+      return r;
+   }
+};
+
+/**
+ * 	The scalar counterpart of selectLess for packs, such that templates
+ * 	can be instantiated with double and SimdPack.
+ * 	@return a if x < y and b otherwise
+ */
+inline double selectLess(double x, double y, double a, double b) {
+   return x < y ? a : b;
+}
+
+} // namespace himalaya
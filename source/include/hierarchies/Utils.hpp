@@ -7,8 +7,15 @@
 
 #pragma once
 
+#include <cmath>
+#include <complex>
+#include <type_traits>
+
 namespace himalaya {
 
+// overloads of log for all scalar types, further ones are found by ADL
+using std::log;
+
 // some templates to perform operations between int's and complex<double>
 template< typename T, typename SCALAR > inline
 typename std::enable_if< !std::is_same<T,SCALAR>::value, std::complex<T> >::type
@@ -42,18 +49,18 @@ template< typename T, typename SCALAR > inline
 typename std::enable_if< !std::is_same<T,SCALAR>::value, std::complex<T> >::type
 operator- ( SCALAR n, const std::complex<T>& c ) { return T(n) - c ; }
 
-template <typename T> T pow2(T x)  { return x*x; }
-template <typename T> T pow3(T x)  { return x*x*x; }
-template <typename T> T pow4(T x)  { return x*x*x*x; }
-template <typename T> T pow5(T x)  { return x*x*x*x*x; }
-template <typename T> T pow6(T x)  { return x*x*x*x*x*x; }
-template <typename T> T pow7(T x)  { return x*x*x*x*x*x*x; }
-template <typename T> T pow8(T x)  { return x*x*x*x*x*x*x*x; }
-template <typename T> T pow9(T x)  { return x*x*x*x*x*x*x*x*x; }
-template <typename T> T power10(T x) { return x*x*x*x*x*x*x*x*x*x; }
-template <typename T> T pow11(T x) { return x*x*x*x*x*x*x*x*x*x*x; }
-template <typename T> T pow12(T x) { return x*x*x*x*x*x*x*x*x*x*x*x; }
-template <typename T> T pow13(T x) { return x*x*x*x*x*x*x*x*x*x*x*x*x; }
-template <typename T> T pow14(T x) { return x*x*x*x*x*x*x*x*x*x*x*x*x*x; }
+template <typename T> T pow2(const T& x)  { return x*x; }
+template <typename T> T pow3(const T& x)  { return x*x*x; }
+template <typename T> T pow4(const T& x)  { return x*x*x*x; }
+template <typename T> T pow5(const T& x)  { return x*x*x*x*x; }
+template <typename T> T pow6(const T& x)  { return x*x*x*x*x*x; }
+template <typename T> T pow7(const T& x)  { return x*x*x*x*x*x*x; }
+template <typename T> T pow8(const T& x)  { return x*x*x*x*x*x*x*x; }
+template <typename T> T pow9(const T& x)  { return x*x*x*x*x*x*x*x*x; }
+template <typename T> T power10(const T& x) { return x*x*x*x*x*x*x*x*x*x; }
+template <typename T> T pow11(const T& x) { return x*x*x*x*x*x*x*x*x*x*x; }
+template <typename T> T pow12(const T& x) { return x*x*x*x*x*x*x*x*x*x*x*x; }
+template <typename T> T pow13(const T& x) { return x*x*x*x*x*x*x*x*x*x*x*x*x; }
+template <typename T> T pow14(const T& x) { return x*x*x*x*x*x*x*x*x*x*x*x*x*x; }
 
 } // namespace himalaya
@@ -0,0 +1,86 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+#include <array>
+#include <cmath>
+
+namespace himalaya {
+
+/**
+ * 	The coefficients of a polynomial in the stop mixing parameter Xt
+ * 	at fixed masses.  The threshold corrections and the hierarchy
+ * 	expansions of delta_lambda are at most of sixth order in Xt.
+ */
+struct XtPolynomial {
+   static constexpr int degree = 6; ///< the maximum power of Xt
+   std::array<double, degree + 1> coefficients{}; ///< the i-th element is the coefficient of Xt^i
+
+   /// returns the coefficient of Xt^i
+   double operator[](int i) const { return coefficients[i]; }
+
+   /**
+    * 	Evaluates the polynomial.
+    * 	@param Xt the stop mixing parameter
+    * 	@return the sum of the coefficients times the powers of Xt
+    */
+   double eval(double Xt) const {
+      double result = 0.;
+      for (int i = degree; i >= 0; i--) {
+         result = result * Xt + coefficients[i];
+      }
+      return result;
+   }
+};
+
+/**
+ * 	Returns the i-th value of Xt, at which interpolateXtPolynomial
+ * 	expects the values of a polynomial.  These are the Chebyshev
+ * 	nodes in [-range, range].
+ * 	@param i the index of the node, 0 <= i <= XtPolynomial::degree
+ * 	@param range the largest absolute value of Xt
+ */
+inline double getXtNode(int i, double range) {
+   const double Pi = 3.1415926535897932384626433832795;
+   return range * std::cos((2 * i + 1) * Pi / (2 * (XtPolynomial::degree + 1)));
+}
+
+/**
+ * 	Determines the coefficients of a polynomial in Xt from its values
+ * 	at the nodes getXtNode(i, range).
+ * 	@param f the values of the polynomial at the nodes
+ * 	@param range the range of the nodes
+ * 	@return the coefficients of the polynomial
+ */
+inline XtPolynomial interpolateXtPolynomial(const std::array<double, XtPolynomial::degree + 1>& f, double range) {
+   const int n = XtPolynomial::degree + 1;
+
+   // the Vandermonde matrix of Xt/range is well conditioned at the Chebyshev nodes
+   Eigen::Matrix<double, n, n> vandermonde;
+   Eigen::Matrix<double, n, 1> values;
+   for (int i = 0; i < n; i++) {
+      const double x = getXtNode(i, 1.);
+      values(i) = f[i];
+      for (int j = 0; j < n; j++) {
+         vandermonde(i, j) = std::pow(x, j);
+      }
+   }
+
+   const Eigen::Matrix<double, n, 1> a = vandermonde.partialPivLu().solve(values);
+
+   XtPolynomial polynomial;
+   for (int j = 0; j < n; j++) {
+      polynomial.coefficients[j] = a(j) / std::pow(range, j);
+   }
+
+   return polynomial;
+}
+
+} // namespace himalaya
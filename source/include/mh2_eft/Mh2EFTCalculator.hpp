@@ -8,10 +8,12 @@
 #pragma once
 
 #include "Himalaya_interface.hpp"
+#include "ThresholdCalculator.hpp"
 #include "dilog.h"
 #include <cmath>
 #include <limits>
 #include <map>
+#include <memory>
 
 namespace himalaya{
 namespace mh2_eft{
@@ -66,7 +68,32 @@ namespace mh2_eft{
        * 	@param enable set to 1 to enable and to 0 to disable the chosen correction
        */
       void setCorrectionFlag(int variable, int enable);
+      /**
+       * 	Returns the ThresholdCalculator of the parameter point, which is shared by all loop orders.
+       * 	It is constructed at the first call and can be borrowed to calculate further threshold corrections.
+       * 	@return The ThresholdCalculator constructed from the parameters and msq2 of this calculator
+       */
+      ThresholdCalculator& getThresholdCalculator();
    private:
+      /// the threshold corrections of a log flag, which are calculated on demand
+      struct ThresholdCorrectionsCache {
+         ThresholdCorrections corrections{}; ///< the threshold corrections
+         unsigned long long calculated{};    ///< bit i is set if the i-th threshold correction has been calculated
+      };
+      /// all EFTOrders enabled
+      static constexpr unsigned int ALL_ORDERS = (1u << EFTOrders::NUMBER_OF_EFT_ORDERS) - 1u;
+
+      /**
+       * 	Returns true if the correction of a given variable is enabled
+       * 	@param variable an integer taken from the EFTOrders enum
+       */
+      bool isEnabled(int variable) const;
+      /**
+       * 	Returns a threshold correction in the DR' scheme, which is calculated at the first request
+       * 	@param variable an integer key for a threshold correction
+       * 	@param omitMSSMLogs an integer flag to remove all Log(mu^2/Mx^2) terms
+       */
+      double getThresholdCorrection(int variable, int omitMSSMLogs);
       /** 
        * 	Checks whether a variable is nan and returns 0 in this case
        *	@param var a variable which should be checked for nan
@@ -79,7 +106,9 @@ namespace mh2_eft{
       std::string tf(const bool tf);
       Parameters p{}; ///< The HimalayaInterface struct
       double msq2{std::numeric_limits<double>::quiet_NaN()}; ///< the average squark mass of the first two generations squared
-      std::map<unsigned int, unsigned int> orderMap{}; ///< A map which holds all EFTOrders key value pairs to enable/disable certain corrections
+      unsigned int orderFlags{ALL_ORDERS}; ///< bit i is set if the correction of the i-th EFTOrders variable is enabled
+      std::unique_ptr<ThresholdCalculator> thresholdCalculator{}; ///< the ThresholdCalculator, which is constructed on demand
+      std::map<int, ThresholdCorrectionsCache> thresholdCorrectionsMap{}; ///< the threshold corrections of each log flag, see getThresholdCorrection
    };
 }	// mh2_eft
 }	// himalaya
@@ -7,11 +7,24 @@
 
 #pragma once
 
+#include "Hierarchies.hpp"
 #include "Himalaya_interface.hpp"
+#include "LogCoefficients.hpp"
+#include "XtPolynomial.hpp"
+#include <array>
 #include <limits>
 
 namespace himalaya{
    
+   /**
+    * 	All threshold corrections of a parameter point in a given scheme, indexed by the ThresholdVariables
+    */
+   struct ThresholdCorrections{
+      std::array<double, ThresholdVariables::NUMBER_OF_THRESHOLD_VARIALES> corrections{}; ///< the threshold corrections
+      /// returns the threshold correction of a ThresholdVariables key
+      double operator[](int variable) const { return corrections[variable]; }
+   };
+
    class ThresholdCalculator{
    public:
       /**
@@ -30,6 +43,23 @@ namespace himalaya{
        * 	@return a threshold correction for a given variable in a given scheme for a suitable mass limit
        */
       double getThresholdCorrection(int variable, int scheme, int omitLogs);
+      /**
+       * 	Returns all threshold corrections for the suitable mass limit, which are calculated in one sweep.
+       * 	The corrections at O(alpha_t*alpha_s^n) share their MSbar parts, which are calculated only once.
+       * 	@param scheme an integer key to set the scheme. Choices are {MSbar, DRbar', DRbar}
+       * 	@param omitLogs an integer to omit all log mu terms
+       * 	@return all threshold corrections, which are equal to the ones of getThresholdCorrection
+       */
+      ThresholdCorrections getThresholdCorrections(int scheme, int omitLogs);
+      /**
+       * 	Returns all threshold corrections as polynomials in log(mu^2/Mst1^2), where mu is the renormalization
+       * 	scale and all masses and couplings are kept fixed.  The mass limit is the one at Parameters::scale.
+       * 	@param scheme an integer key to set the scheme. Choices are {MSbar, DRbar', DRbar}
+       * 	@param omitLogs an integer to omit all log mu terms
+       * 	@return the coefficients of the threshold corrections, indexed by the ThresholdVariables
+       */
+      std::array<LogCoefficients<double>, ThresholdVariables::NUMBER_OF_THRESHOLD_VARIALES>
+	 getThresholdCorrectionLogCoefficients(int scheme, int omitLogs);
       /**
        * 	Returns the shift needed to convert the 3L threshold correction of lambda to the MSbar scheme
        * 	@param xtOrder an integer key to omit the Xt contributions starting at xtOrder + 1
@@ -37,6 +67,14 @@ namespace himalaya{
        * 	@param omitXtLogs an integer key to omit all Xt^4*Log[mu] and Xt^5*Log[mu] terms
        */
       double getDRbarPrimeToMSbarShift(int xtOrder, int omitLogs, int omitXtLogs = 1);
+      /**
+       * 	Returns the shift needed to convert the 3L threshold correction of lambda to the MSbar scheme as a polynomial in Xt,
+       * 	where all masses and the mass limit are kept fixed, see getDRbarPrimeToMSbarShift
+       * 	@param xtOrder an integer key to omit the Xt contributions starting at xtOrder + 1
+       * 	@param omitLogs an integer key to omit all log mu terms
+       * 	@param omitXtLogs an integer key to omit all Xt^4*Log[mu] and Xt^5*Log[mu] terms
+       */
+      XtPolynomial getDRbarPrimeToMSbarShiftXtPolynomial(int xtOrder, int omitLogs, int omitXtLogs = 1);
       /**
        * 	Returns the DRbarPrime to MSbar shift of delta lambda 3L at a given xtOrder
        * 	@param limit an integer key for a mass limit
@@ -45,16 +83,22 @@ namespace himalaya{
        */
       double getDRbarPrimeToMSbarXtTerms(int limit, int xtOrder, int omitLogs);
       /**
-       * 	Sets the mass limit to check terms
+       * 	Sets the mass limit of the threshold corrections, e.g. to check terms or to reuse a limit
+       * 	which has been determined before.  The determination of the mass limit is skipped then.
        * 	@param limit an integer key for a mass limit
        */
       void setLimit(int limit);
       /**
-       * 	Get the mass limit determined by ThresholdCalculator
+       * 	Get the mass limit determined by ThresholdCalculator.  The mass limit is determined
+       * 	at the first request of the limit or a limit dependent threshold correction.
        * 	@return The determined mass limit
        */
       int getLimit();
    private:
+      /**
+       * 	Determines the mass limit of the threshold corrections for nearly degenerate masses
+       */
+      void determineLimit();
       /**
        * 	Returns delta g3_as in the MSbar scheme for a given mass limit
        * 	@param omitLogs an integer key to omit all mu terms
@@ -387,6 +431,7 @@ namespace himalaya{
       bool isfinite(double exact, double shifted, double limit);
       Parameters p{}; ///< The HimalayaInterface struct
       double msq2{std::numeric_limits<double>::quiet_NaN()}; ///< the average squark mass of the first two generations squared
+      bool limitDetermined{false}; ///< whether the mass limit has been determined or set
    };
    
 }	// himalaya
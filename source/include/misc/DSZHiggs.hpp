@@ -0,0 +1,80 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+#pragma once
+
+#include <vector>
+
+namespace himalaya {
+namespace mh2l {
+
+/**
+ * 	The input parameters of the two-loop O(at*as) corrections for many
+ * 	parameter points as structure of arrays, where the i-th element of
+ * 	each variable belongs to the i-th point.  The variables are the
+ * 	arguments of dszhiggs.
+ */
+struct DSZBatch {
+   std::vector<double> t;    ///< squared top mass
+   std::vector<double> mg;   ///< gluino mass
+   std::vector<double> T1;   ///< squared lighter stop mass
+   std::vector<double> T2;   ///< squared heavier stop mass
+   std::vector<double> st;   ///< sine of the stop mixing angle
+   std::vector<double> ct;   ///< cosine of the stop mixing angle
+   std::vector<double> q;    ///< squared renormalization scale
+   std::vector<double> mu;   ///< Higgs mixing parameter, note the sign convention of DSZ
+   std::vector<double> tanb; ///< ratio of the Higgs vevs
+   std::vector<double> v2;   ///< squared Higgs vev
+   std::vector<double> gs;   ///< strong coupling constant
+};
+
+/**
+ * 	The two-loop O(at*as) corrections to the CP-even Higgs mass matrix
+ * 	for many parameter points as structure of arrays.
+ */
+struct DSZResultBatch {
+   std::vector<double> S11; ///< (1, 1) matrix elements
+   std::vector<double> S22; ///< (2, 2) matrix elements
+   std::vector<double> S12; ///< (1, 2) matrix elements
+};
+
+/**
+ * 	Calculates the two-loop O(at*as) corrections to the CP-even Higgs
+ * 	mass matrix.  This is a C++ port of the Fortran routine dszhiggs by
+ * 	P. Slavich [hep-ph/0105096], which agrees with it up to rounding.
+ * 	@param t squared top mass
+ * 	@param mg gluino mass
+ * 	@param T1 squared lighter stop mass
+ * 	@param T2 squared heavier stop mass
+ * 	@param st sine of the stop mixing angle
+ * 	@param ct cosine of the stop mixing angle
+ * 	@param q squared renormalization scale
+ * 	@param mu Higgs mixing parameter, note the sign convention of DSZ
+ * 	@param tanb ratio of the Higgs vevs
+ * 	@param v2 squared Higgs vev
+ * 	@param gs strong coupling constant
+ * 	@param OS the renormalization scheme of the one-loop part, 0 for DR and 1 for on-shell
+ * 	@param S11 the (1, 1) matrix element, which is calculated
+ * 	@param S22 the (2, 2) matrix element, which is calculated
+ * 	@param S12 the (1, 2) matrix element, which is calculated
+ */
+void dszhiggs(double t, double mg, double T1, double T2, double st, double ct, double q,
+              double mu, double tanb, double v2, double gs, int OS,
+              double& S11, double& S22, double& S12) noexcept;
+
+/**
+ * 	Calculates the two-loop O(at*as) corrections to the CP-even Higgs
+ * 	mass matrix for many parameter points.  The points are evaluated in
+ * 	one loop over the inlined kernel of dszhiggs.
+ * 	@param points the input parameters of the points
+ * 	@param OS the renormalization scheme of the one-loop part, 0 for DR and 1 for on-shell
+ * 	@return the matrix elements of all points
+ */
+DSZResultBatch dszhiggs(const DSZBatch& points, int OS);
+
+} // namespace mh2l
+} // namespace himalaya
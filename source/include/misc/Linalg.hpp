@@ -0,0 +1,30 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <Eigen/Core>
+
+namespace himalaya {
+
+/**
+ * 	Calculates the lowest eigenvalue of a real symmetric 2x2 matrix in closed form.
+ * 	@param matrix the real symmetric matrix, only the upper triangle is used.
+ * 	@return The lowest eigenvalue.
+ */
+double calcLowestEigenvalue(const Eigen::Matrix2d& matrix) noexcept;
+
+/**
+ * 	Calculates the lowest eigenvalues of many real symmetric 2x2 matrices in closed form.
+ * 	@param matrices pointer to the real symmetric matrices, only the upper triangles are used.
+ * 	@param n the number of matrices.
+ * 	@param eigenvalues pointer to the n lowest eigenvalues, which are calculated.
+ */
+void calcLowestEigenvalues(const Eigen::Matrix2d* matrices, std::size_t n, double* eigenvalues) noexcept;
+
+} // namespace himalaya
@@ -0,0 +1,197 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+#pragma once
+
+#include "SimdPack.hpp"
+#include <cmath>
+#include <cstddef>
+
+namespace himalaya {
+
+/**
+ * 	Real part of the dilogarithm Li2(x) for real x.
+ *
+ * 	The argument is mapped to y in [-1, 1/2] by the reflection and
+ * 	inversion identities, where the branches are replaced by the
+ * 	selection of the transformed argument and of the additive terms.
+ * 	Li2(y) is summed as a series in z = -log(1 - y) with the Bernoulli
+ * 	numbers, which converges to double precision with nine terms for
+ * 	|z| <= log(2).  The function can be instantiated with double and
+ * 	with SimdPack, in which case all elements are evaluated at once.
+ * 	@param x the argument
+ * 	@return Re Li2(x)
+ */
+template <typename T>
+T dilog(const T& x) {
+   using std::log;
+   using std::log1p;
+
+   // B_{2k}/(2k + 1)!
+   static const double b[9] = {
+      0.027777777777777776,
+      -0.0002777777777777778,
+      4.72411186696901e-06,
+      -9.185773074661964e-08,
+      1.8978869988971e-09,
+      -4.0647616451442256e-11,
+      8.921691020456452e-13,
+      -1.9939295860721074e-14,
+      4.518980029619918e-16
+   };
+
+   const double pi2_6 = 1.6449340668482264; // pi^2/6
+   const T one(1.), half(0.5), two(2.), minusOne(-1.), zero(0.);
+
+   // x < -1:       Li2(x) = -pi^2/6 - log^2(-x)/2 - Li2(1/x)
+   // -1 <= x <= 1/2: Li2(x)
+   // 1/2 < x <= 1:  Li2(x) = pi^2/6 - log(x)*log(1 - x) - Li2(1 - x)
+   // 1 < x <= 2:    Li2(x) = pi^2/6 - log^2(x)/2 - log(x)*log(1 - 1/x) + Li2(1 - 1/x)
+   // x > 2:         Li2(x) = pi^2/3 - log^2(x)/2 - Li2(1/x)
+   T y = selectLess(two, x, one/x, (x - one)/x);
+   y = selectLess(one, x, y, one - x);
+   y = selectLess(half, x, y, x);
+   y = selectLess(x, minusOne, one/x, y);
+
+   T sign = selectLess(two, x, minusOne, one);
+   sign = selectLess(one, x, sign, minusOne);
+   sign = selectLess(half, x, sign, one);
+   sign = selectLess(x, minusOne, minusOne, sign);
+
+   T constant = selectLess(two, x, T(2*pi2_6), T(pi2_6));
+   constant = selectLess(half, x, constant, zero);
+   constant = selectLess(x, minusOne, T(-pi2_6), constant);
+
+   // the coefficient of log^2(a)/2
+   T square = selectLess(half, x, selectLess(one, x, one, zero), zero);
+   square = selectLess(x, minusOne, one, square);
+
+   // the arguments of the logarithms are set to 1 where they do not contribute
+   const T a = selectLess(x, minusOne, -x, selectLess(half, x, x, one));
+   T c = selectLess(half, x, selectLess(two, x, one, y), one);
+   c = selectLess(zero, c, c, one);
+
+   const T la = log(a);
+   const T lc = log(c);
+
+   const T z = -log1p(-y);
+   const T z2 = z*z;
+
+   T sum(b[8]);
+   for (int k = 7; k >= 0; k--) {
+      sum = sum*z2 + T(b[k]);
+   }
+
+   const T li2 = z*(one - T(0.25)*z) + z*z2*sum;
+
+   return constant - T(0.5)*square*la*la - la*lc + sign*li2;
+}
+
+/**
+ * 	Clausen function Cl2(x) for real x.
+ *
+ * 	The argument is reduced to [0, pi] by the periodicity and the
+ * 	antisymmetry of Cl2 without branches.  Cl2 is then summed as a
+ * 	series around 0 below 2pi/3 and as a series around pi above, each
+ * 	of which converges to double precision with sixteen terms.  The
+ * 	function can be instantiated with double and with SimdPack.
+ * 	@param x the argument
+ * 	@return Cl2(x)
+ */
+template <typename T>
+T clausen_2(const T& x) {
+   using std::floor;
+   using std::log;
+
+   // |B_{2k}|/(2k (2k + 1)!), coefficients of the series around 0
+   static const double c0[16] = {
+      0.013888888888888888,
+      6.944444444444444e-05,
+      7.873519778281683e-07,
+      1.1482216343327455e-08,
+      1.8978869988971e-10,
+      3.387301370953521e-12,
+      6.372636443183181e-14,
+      1.2462059912950672e-15,
+      2.5105444608999545e-17,
+      5.178258806090623e-19,
+      1.0887357368300849e-20,
+      2.325744114302087e-22,
+      5.03519521314739e-24,
+      1.1026499294381215e-25,
+      2.4386585509007344e-27,
+      5.440142678856253e-29
+   };
+
+   // -(2^{2k} - 1) |B_{2k}|/(2k (2k + 1)!), coefficients of the series around pi
+   static const double cpi[16] = {
+      -0.041666666666666664,
+      -0.0010416666666666667,
+      -4.96031746031746e-05,
+      -2.927965167548501e-06,
+      -1.941538399871733e-07,
+      -1.3870999114054669e-08,
+      -1.0440290284867003e-09,
+      -8.167010963952224e-11,
+      -6.5812165661369675e-12,
+      -5.429792727596475e-13,
+      -4.5664875671936356e-14,
+      -3.901950904063069e-15,
+      -3.3790622573736396e-16,
+      -2.9599033551444004e-17,
+      -2.618489678118693e-18,
+      -2.336523488582129e-19
+   };
+
+   // 2pi and pi split into a leading part and a correction
+   const double pi2_hi = 6.283185307179586, pi2_lo = 2.4492935982947064e-16;
+   const double pi_hi = 3.141592653589793, pi_lo = 1.2246467991473532e-16;
+   const double log2 = 0.6931471805599453;
+   const T one(1.), zero(0.), minusOne(-1.);
+
+   // reduction to [0, 2pi) and by Cl2(2pi - x) = -Cl2(x) to [0, pi]
+   const T n = floor(x*T(1./pi2_hi));
+   T r = (x - n*T(pi2_hi)) - n*T(pi2_lo);
+   const T sign = selectLess(T(pi_hi), r, minusOne, one);
+   r = selectLess(T(pi_hi), r, (T(pi2_hi) - r) + T(pi2_lo), r);
+
+   // Cl2(w) = w (1 - log(w) + w^2 sum_k c0_k w^(2k-2)) for w = r below 2pi/3
+   // Cl2(pi - w) = w (log(2) + w^2 sum_k cpi_k w^(2k-2)) for w = pi - r above
+   const T below = selectLess(r, T(2*pi_hi/3), one, zero);
+   const T w = selectLess(zero, below, r, (T(pi_hi) - r) + T(pi_lo));
+   const T w2 = w*w;
+
+   T sum = selectLess(zero, below, T(c0[15]), T(cpi[15]));
+   for (int k = 14; k >= 0; k--) {
+      sum = sum*w2 + selectLess(zero, below, T(c0[k]), T(cpi[k]));
+   }
+
+   const T l = log(selectLess(zero, below, selectLess(zero, w, w, one), one));
+   const T leading = selectLess(zero, below, one - l, T(log2));
+
+   return sign*w*(leading + w2*sum);
+}
+
+/**
+ * 	Calculates the real part of the dilogarithm for many arguments,
+ * 	which are evaluated in packs of SIMD_WIDTH elements.
+ * 	@param x pointer to the arguments
+ * 	@param n the number of arguments
+ * 	@param li2 pointer to the n results, which are calculated
+ */
+void dilog(const double* x, std::size_t n, double* li2) noexcept;
+
+/**
+ * 	Calculates the Clausen function Cl2 for many arguments, which are
+ * 	evaluated in packs of SIMD_WIDTH elements.
+ * 	@param x pointer to the arguments
+ * 	@param n the number of arguments
+ * 	@param cl2 pointer to the n results, which are calculated
+ */
+void clausen_2(const double* x, std::size_t n, double* cl2) noexcept;
+
+} // namespace himalaya
@@ -0,0 +1,93 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace himalaya {
+
+/**
+ * 	A pool of worker threads which executes a batch of indexed tasks.
+ *
+ * 	Each worker owns a queue with a contiguous block of task indices,
+ * 	which it processes from the front.  A worker which runs out of
+ * 	tasks steals tasks from the back of the queues of the other
+ * 	workers, so that tasks of very different cost are balanced.
+ */
+class ThreadPool {
+public:
+   /// the task, which is called with the index of the task
+   typedef std::function<void(std::size_t)> Task;
+
+   /**
+    * 	Starts the worker threads.
+    * 	@param numberOfWorkers the number of worker threads. If 0, the number of hardware threads is used.
+    */
+   explicit ThreadPool(unsigned int numberOfWorkers = 0);
+   /**
+    * 	Stops and joins the worker threads.
+    */
+   ~ThreadPool();
+   ThreadPool(const ThreadPool&) = delete;
+   ThreadPool& operator=(const ThreadPool&) = delete;
+
+   /**
+    * 	@return The number of worker threads.
+    */
+   unsigned int getNumberOfWorkers() const;
+   /**
+    * 	Calls task(i) for all i in [0, numberOfTasks) on the worker threads and waits until all tasks are done.
+    * 	Concurrent calls of this function are processed one after the other.
+    * 	@param numberOfTasks the number of tasks.
+    * 	@param task the task, which must be safe to be called concurrently.
+    * 	@throws The first exception thrown by a task, after all remaining tasks are done.
+    */
+   void run(std::size_t numberOfTasks, const Task& task);
+
+private:
+   /// the task indices owned by a single worker
+   struct WorkQueue {
+      std::mutex mutex{};              ///< guards the task indices
+      std::deque<std::size_t> tasks{}; ///< task indices
+   };
+
+   std::vector<std::unique_ptr<WorkQueue>> queues{}; ///< one queue per worker
+   std::vector<std::thread> workers{};                ///< worker threads
+   std::mutex runMutex{};                             ///< serializes concurrent calls of run()
+   std::mutex mutex{};                                ///< guards the members below
+   std::condition_variable startCondition{};          ///< signals a new batch or the stop to the workers
+   std::condition_variable doneCondition{};           ///< signals the end of a batch to run()
+   const Task* currentTask{nullptr};                  ///< task of the current batch
+   unsigned long batch{0};                            ///< number of the current batch
+   unsigned int busyWorkers{0};                       ///< number of workers which work on the current batch
+   std::exception_ptr exception{};                    ///< first exception thrown by a task of the current batch
+   bool stop{false};                                  ///< stops the workers if true
+
+   /**
+    * 	The loop executed by each worker thread.
+    * 	@param worker the index of the worker.
+    */
+   void work(unsigned int worker);
+   /**
+    * 	Takes a task index from the queue of the given worker or steals one from another worker.
+    * 	@param worker the index of the worker.
+    * 	@param index the taken task index.
+    * 	@return False if there are no tasks left, true otherwise.
+    */
+   bool takeTask(unsigned int worker, std::size_t& index);
+};
+
+} // namespace himalaya
@@ -10,6 +10,8 @@
 #include "Hierarchies.hpp"
 #include "Logger.hpp"
 #include <cmath>
+#include <stdexcept>
+#include <string>
 
 namespace himalaya {
 namespace mh2_eft {
@@ -55,18 +57,37 @@ himalaya::mh2_eft::Mh2EFTCalculator::Mh2EFTCalculator(
 
    if (!std::isfinite(msq2_))
       msq2 = p.calculateMsq2();
-   
-   // fill order map
-   orderMap.clear();
-   for (int i = EFTOrders::FIRST; i < EFTOrders::NUMBER_OF_EFT_ORDERS; i++) {
-      orderMap.emplace(i, 1u);
-   }
 }
 
 void himalaya::mh2_eft::Mh2EFTCalculator::setCorrectionFlag(int variable, int enable){
    if(enable < 0 || enable > 1) INFO_MSG("You can only enable (1) or disable (0) corrections!");
-   if(orderMap.find(variable) == orderMap.end()) INFO_MSG("Your variable is not defined in the EFTOrders enum!");
-   orderMap.at(variable) = enable;
+   if(variable < EFTOrders::FIRST || variable >= EFTOrders::NUMBER_OF_EFT_ORDERS){
+      INFO_MSG("Your variable is not defined in the EFTOrders enum!");
+      throw std::out_of_range("EFT order " + std::to_string(variable) + " not included!");
+   }
+
+   const unsigned int bit = 1u << variable;
+   orderFlags = enable ? (orderFlags | bit) : (orderFlags & ~bit);
+}
+
+/**
+ * 	Returns true if the correction of a given variable is enabled
+ * 	@param variable an integer taken from the EFTOrders enum
+ */
+bool himalaya::mh2_eft::Mh2EFTCalculator::isEnabled(int variable) const{
+   return (orderFlags >> variable) & 1u;
+}
+
+/**
+ * 	Returns the ThresholdCalculator of the parameter point, which is shared by all loop orders.
+ * 	@return The ThresholdCalculator constructed from the parameters and msq2 of this calculator
+ */
+himalaya::ThresholdCalculator& himalaya::mh2_eft::Mh2EFTCalculator::getThresholdCalculator()
+{
+   if (!thresholdCalculator)
+      thresholdCalculator.reset(new ThresholdCalculator(p, msq2));
+
+   return *thresholdCalculator;
 }
 
 double himalaya::mh2_eft::Mh2EFTCalculator::getDeltaMh2EFT0Loop()
@@ -74,6 +95,34 @@ double himalaya::mh2_eft::Mh2EFTCalculator::getDeltaMh2EFT0Loop()
    return pow2(p.MZ * std::cos(2 * std::atan(p.vu/p.vd)));
 }
 
+/**
+ * 	Returns a threshold correction in the DR' scheme, which is calculated at the first request
+ * 	@param variable an integer key for a threshold correction
+ * 	@param omitMSSMLogs an integer flag to remove all Log(mu^2/Mx^2) terms
+ * 	@return The threshold correction of getThresholdCalculator
+ */
+double himalaya::mh2_eft::Mh2EFTCalculator::getThresholdCorrection(int variable, int omitMSSMLogs)
+{
+   ThresholdCorrectionsCache& cache = thresholdCorrectionsMap[omitMSSMLogs];
+
+   // if all orders are enabled, all threshold corrections are needed and calculated in one sweep
+   if (cache.calculated == 0 && orderFlags == ALL_ORDERS) {
+      cache.corrections = getThresholdCalculator().getThresholdCorrections(
+	 RenSchemes::DRBARPRIME, omitMSSMLogs);
+      cache.calculated = ~0ull;
+   }
+
+   const unsigned long long bit = 1ull << variable;
+
+   if (!(cache.calculated & bit)) {
+      cache.corrections.corrections[variable] = getThresholdCalculator().getThresholdCorrection(
+	 variable, RenSchemes::DRBARPRIME, omitMSSMLogs);
+      cache.calculated |= bit;
+   }
+
+   return cache.corrections[variable];
+}
+
 /**
  * 	Returns the 1-loop EFT contribution to the Higgs mass
  * 	@param omitSMLogs an integer flag to remove all Log(mu^2/mt^2) terms
@@ -81,8 +130,6 @@ double himalaya::mh2_eft::Mh2EFTCalculator::getDeltaMh2EFT0Loop()
  */
 double himalaya::mh2_eft::Mh2EFTCalculator::getDeltaMh2EFT1Loop(int omitSMLogs, 
 								int omitMSSMLogs){
-   ThresholdCalculator thresholdCalculator(p, msq2);
-   
    using std::log;
    const double lmMt = omitSMLogs * log(pow2(p.scale / p.Mt));
    
@@ -105,91 +152,105 @@ double himalaya::mh2_eft::Mh2EFTCalculator::getDeltaMh2EFT1Loop(int omitSMLogs,
    const double lmzMt = log(pow2(p.MZ / p.Mt));
    const int Xi = 1;	// gauge parameter
    
-   // Threshold corrections
-   const double dlambdayb2g12 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YB2_G12, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdag14 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_G14, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdaregg14 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_REG_G14, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdachig14 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_CHI_G14, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dg1g1 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::G1_G1, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdachig24 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_CHI_G24, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdag24 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_G24, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dg2g2 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::G2_G2, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdaregg24 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_REG_G24, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdag12g22 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_G12_G22, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdaregg12g22 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_REG_G12_G22, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdachig12g22 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_CHI_G12_G22, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdayb2g22 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YB2_G22, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdayb4 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YB4, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdayt2g12 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YT2_G12, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dvyt2 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::VEV_YT2, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdayt2g22 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YT2_G22, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdaytau2g12 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YTAU2_G12, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdaytau2g22 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YTAU2_G22, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdaytau4 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YTAU4, RenSchemes::DRBARPRIME, omitMSSMLogs);
-
    // corrections to Mh2
-   const double dmh2g12g22 = isNaN(orderMap.at(EFTOrders::G12G22)*(pow2(cbeta)*v2*(10
-      *dlambdayb2g12 - 9*pow2(c2beta)*(2 + lmMt - lmhtreeMt))/20.));
-   const double dmh2g14 = isNaN(orderMap.at(EFTOrders::G14)*((v2*(20*(-36 
-      + 100*dlambdag14 + 100*dlambdaregg14 + 100*
-      dlambdachig14 - 27*lmMt + 27*lmzMt) - 30*(40*dg1g1 + 6*(-2 + lmzMt) +
-      3*lmMt*(-3 + Xi))*pow2(c2beta) + 9*(-126 + 45*lmhtreeMt - 60*lmMt + 10*
-      lmwMt + 5*lmzMt + 15*sqrt(3)*Pi)*pow4(c2beta) + 180*asin(mhtree/(2*p.MW)
-      )*sqrt(-1 + (4*pow2(p.MW))/pow2(mhtree))*pow4(c2beta) + 90*asin(c2beta/
-      2.)*sqrt(-1 + 4/pow2(c2beta))*(12 - 4*pow2(c2beta) + pow4(c2beta))))/4000.));
-   const double dmh2g24 = isNaN(orderMap.at(EFTOrders::G24)*((v2*(20*(-12 
-      + 4*dlambdachig24 + 4*dlambdag24 + 4*
-      dlambdaregg24 - 9*lmMt + 6*lmwMt + 3*lmzMt) - 10*(8*dg2g2 + 2*(-6 + 
-      2*lmwMt + lmzMt) + 3*lmMt*(-3 + Xi))*pow2(c2beta) + (-126 + 45*lmhtreeMt -
-      60*lmMt + 10*lmwMt + 5*lmzMt + 15*sqrt(3.)*Pi)*pow4(c2beta) + 10*asin(
-      c2beta/2.)*sqrt(-1 + 4/pow2(c2beta))*(12 - 4*pow2(c2beta) + pow4(c2beta))
-      + 20*asin(mhtree/(2*p.MW))*sqrt(-1 + (4*pow2(p.MW))/pow2(mhtree))*(12 - 4*
-      pow2(c2beta) + pow4(c2beta))))/160.));
-   const double dmh2g12yb2 = isNaN(orderMap.at(EFTOrders::G12YB2)*((v2*(20*(-12 
-      + 10*dlambdag12g22 + 10*dlambdaregg12g22 + 10*
-      dlambdachig12g22 - 9*lmMt + 9*lmzMt) - 60*(-4 + lmwMt + lmzMt + lmMt*(-
-      3 + Xi))*pow2(c2beta) + 60*asin(mhtree/(2*p.MW))*(-2 + pow2(c2beta))*
-      pow2(c2beta)*sqrt(-1 + (4*pow2(p.MW))/pow2(mhtree)) + 3*(-126 + 45*
-      lmhtreeMt - 60*lmMt + 10*lmwMt + 5*lmzMt + 15*sqrt(3.)*Pi)*pow4(c2beta)
-      + 30*asin(c2beta/2.)*sqrt(-1 + 4/pow2(c2beta))*(12 - 4*pow2(c2beta) +
-      pow4(c2beta))))/400.));
-   const double dmh2g22yb2 = isNaN(orderMap.at(EFTOrders::G22YB2)*(pow2(cbeta)*v2*(2
-      *dlambdayb2g22 + 3*pow2(c2beta)*(-2 + lmhtreeMt - lmMt))/4.));
-   const double dmh2yb4 = isNaN(orderMap.at(EFTOrders::YB4)*(pow4(cbeta)*v2
-      *(dlambdayb4 + 12*(2 - lmhtreeMt + lmMt))/2.));
-   const double dmh2g12yt2 = isNaN(orderMap.at(EFTOrders::G12YT2)*(pow2(sbeta)*v2*(10
-      *dlambdayt2g12 + pow2(c2beta)*(6 + 6*dvyt2 - 9*lmMt))/20.));
-   const double dmh2g22yt2 = isNaN(orderMap.at(EFTOrders::G22YT2)*(pow2(sbeta)*v2*(2
-      *dlambdayt2g22 + pow2(c2beta)*(2 + 2*dvyt2 - 3*lmMt))/4.));
-   const double dmh2yt4 = isNaN(orderMap.at(EFTOrders::YT4)*(pref_at*(12 * lmMt +
-      thresholdCalculator.getThresholdCorrection(ThresholdVariables::LAMBDA_AT,
-	 RenSchemes::DRBARPRIME, omitMSSMLogs))));
-   const double dmh2g12ytau2 = isNaN(orderMap.at(EFTOrders::G12YTAU2)*(pow2(cbeta)*v2*(
-      10*dlambdaytau2g12 + 3*pow2(c2beta)*(-2 + lmhtreeMt - lmMt))/20.));
-   const double dmh2g22ytau2 = isNaN(orderMap.at(EFTOrders::G22YTAU2)*(pow2(cbeta)*v2*(2
-      *dlambdaytau2g22 + pow2(c2beta)*(-2 + lmhtreeMt - lmMt))/4.));
-   const double dmh2ytau4 = isNaN(orderMap.at(EFTOrders::YTAU4)*(pow4(cbeta)*v2*(8
-      + dlambdaytau4 - 4*lmhtreeMt + 4*lmMt)/2.));
+   double dmh2g12g22 = 0.;
+   if (isEnabled(EFTOrders::G12G22)) {
+      const double dlambdayb2g12 = getThresholdCorrection(ThresholdVariables::LAMBDA_YB2_G12, omitMSSMLogs);
+      dmh2g12g22 = isNaN(pow2(cbeta)*v2*(10
+         *dlambdayb2g12 - 9*pow2(c2beta)*(2 + lmMt - lmhtreeMt))/20.);
+   }
+   double dmh2g14 = 0.;
+   if (isEnabled(EFTOrders::G14)) {
+      const double dlambdag14 = getThresholdCorrection(ThresholdVariables::LAMBDA_G14, omitMSSMLogs);
+      const double dlambdaregg14 = getThresholdCorrection(ThresholdVariables::LAMBDA_REG_G14, omitMSSMLogs);
+      const double dlambdachig14 = getThresholdCorrection(ThresholdVariables::LAMBDA_CHI_G14, omitMSSMLogs);
+      const double dg1g1 = getThresholdCorrection(ThresholdVariables::G1_G1, omitMSSMLogs);
+      dmh2g14 = isNaN((v2*(20*(-36 
+         + 100*dlambdag14 + 100*dlambdaregg14 + 100*
+         dlambdachig14 - 27*lmMt + 27*lmzMt) - 30*(40*dg1g1 + 6*(-2 + lmzMt) +
+         3*lmMt*(-3 + Xi))*pow2(c2beta) + 9*(-126 + 45*lmhtreeMt - 60*lmMt + 10*
+         lmwMt + 5*lmzMt + 15*sqrt(3)*Pi)*pow4(c2beta) + 180*asin(mhtree/(2*p.MW)
+         )*sqrt(-1 + (4*pow2(p.MW))/pow2(mhtree))*pow4(c2beta) + 90*asin(c2beta/
+         2.)*sqrt(-1 + 4/pow2(c2beta))*(12 - 4*pow2(c2beta) + pow4(c2beta))))/4000.);
+   }
+   double dmh2g24 = 0.;
+   if (isEnabled(EFTOrders::G24)) {
+      const double dlambdachig24 = getThresholdCorrection(ThresholdVariables::LAMBDA_CHI_G24, omitMSSMLogs);
+      const double dlambdag24 = getThresholdCorrection(ThresholdVariables::LAMBDA_G24, omitMSSMLogs);
+      const double dlambdaregg24 = getThresholdCorrection(ThresholdVariables::LAMBDA_REG_G24, omitMSSMLogs);
+      const double dg2g2 = getThresholdCorrection(ThresholdVariables::G2_G2, omitMSSMLogs);
+      dmh2g24 = isNaN((v2*(20*(-12 
+         + 4*dlambdachig24 + 4*dlambdag24 + 4*
+         dlambdaregg24 - 9*lmMt + 6*lmwMt + 3*lmzMt) - 10*(8*dg2g2 + 2*(-6 + 
+         2*lmwMt + lmzMt) + 3*lmMt*(-3 + Xi))*pow2(c2beta) + (-126 + 45*lmhtreeMt -
+         60*lmMt + 10*lmwMt + 5*lmzMt + 15*sqrt(3.)*Pi)*pow4(c2beta) + 10*asin(
+         c2beta/2.)*sqrt(-1 + 4/pow2(c2beta))*(12 - 4*pow2(c2beta) + pow4(c2beta))
+         + 20*asin(mhtree/(2*p.MW))*sqrt(-1 + (4*pow2(p.MW))/pow2(mhtree))*(12 - 4*
+         pow2(c2beta) + pow4(c2beta))))/160.);
+   }
+   double dmh2g12yb2 = 0.;
+   if (isEnabled(EFTOrders::G12YB2)) {
+      const double dlambdag12g22 = getThresholdCorrection(ThresholdVariables::LAMBDA_G12_G22, omitMSSMLogs);
+      const double dlambdaregg12g22 = getThresholdCorrection(ThresholdVariables::LAMBDA_REG_G12_G22, omitMSSMLogs);
+      const double dlambdachig12g22 = getThresholdCorrection(ThresholdVariables::LAMBDA_CHI_G12_G22, omitMSSMLogs);
+      dmh2g12yb2 = isNaN((v2*(20*(-12 
+         + 10*dlambdag12g22 + 10*dlambdaregg12g22 + 10*
+         dlambdachig12g22 - 9*lmMt + 9*lmzMt) - 60*(-4 + lmwMt + lmzMt + lmMt*(-
+         3 + Xi))*pow2(c2beta) + 60*asin(mhtree/(2*p.MW))*(-2 + pow2(c2beta))*
+         pow2(c2beta)*sqrt(-1 + (4*pow2(p.MW))/pow2(mhtree)) + 3*(-126 + 45*
+         lmhtreeMt - 60*lmMt + 10*lmwMt + 5*lmzMt + 15*sqrt(3.)*Pi)*pow4(c2beta)
+         + 30*asin(c2beta/2.)*sqrt(-1 + 4/pow2(c2beta))*(12 - 4*pow2(c2beta) +
+         pow4(c2beta))))/400.);
+   }
+   double dmh2g22yb2 = 0.;
+   if (isEnabled(EFTOrders::G22YB2)) {
+      const double dlambdayb2g22 = getThresholdCorrection(ThresholdVariables::LAMBDA_YB2_G22, omitMSSMLogs);
+      dmh2g22yb2 = isNaN(pow2(cbeta)*v2*(2
+         *dlambdayb2g22 + 3*pow2(c2beta)*(-2 + lmhtreeMt - lmMt))/4.);
+   }
+   double dmh2yb4 = 0.;
+   if (isEnabled(EFTOrders::YB4)) {
+      const double dlambdayb4 = getThresholdCorrection(ThresholdVariables::LAMBDA_YB4, omitMSSMLogs);
+      dmh2yb4 = isNaN(pow4(cbeta)*v2
+         *(dlambdayb4 + 12*(2 - lmhtreeMt + lmMt))/2.);
+   }
+   double dmh2g12yt2 = 0.;
+   if (isEnabled(EFTOrders::G12YT2)) {
+      const double dlambdayt2g12 = getThresholdCorrection(ThresholdVariables::LAMBDA_YT2_G12, omitMSSMLogs);
+      const double dvyt2 = getThresholdCorrection(ThresholdVariables::VEV_YT2, omitMSSMLogs);
+      dmh2g12yt2 = isNaN(pow2(sbeta)*v2*(10
+         *dlambdayt2g12 + pow2(c2beta)*(6 + 6*dvyt2 - 9*lmMt))/20.);
+   }
+   double dmh2g22yt2 = 0.;
+   if (isEnabled(EFTOrders::G22YT2)) {
+      const double dlambdayt2g22 = getThresholdCorrection(ThresholdVariables::LAMBDA_YT2_G22, omitMSSMLogs);
+      const double dvyt2 = getThresholdCorrection(ThresholdVariables::VEV_YT2, omitMSSMLogs);
+      dmh2g22yt2 = isNaN(pow2(sbeta)*v2*(2
+         *dlambdayt2g22 + pow2(c2beta)*(2 + 2*dvyt2 - 3*lmMt))/4.);
+   }
+   double dmh2yt4 = 0.;
+   if (isEnabled(EFTOrders::YT4)) {
+      dmh2yt4 = isNaN(pref_at*(12 * lmMt +
+         getThresholdCorrection(ThresholdVariables::LAMBDA_AT, omitMSSMLogs)));
+   }
+   double dmh2g12ytau2 = 0.;
+   if (isEnabled(EFTOrders::G12YTAU2)) {
+      const double dlambdaytau2g12 = getThresholdCorrection(ThresholdVariables::LAMBDA_YTAU2_G12, omitMSSMLogs);
+      dmh2g12ytau2 = isNaN(pow2(cbeta)*v2*(
+         10*dlambdaytau2g12 + 3*pow2(c2beta)*(-2 + lmhtreeMt - lmMt))/20.);
+   }
+   double dmh2g22ytau2 = 0.;
+   if (isEnabled(EFTOrders::G22YTAU2)) {
+      const double dlambdaytau2g22 = getThresholdCorrection(ThresholdVariables::LAMBDA_YTAU2_G22, omitMSSMLogs);
+      dmh2g22ytau2 = isNaN(pow2(cbeta)*v2*(2
+         *dlambdaytau2g22 + pow2(c2beta)*(-2 + lmhtreeMt - lmMt))/4.);
+   }
+   double dmh2ytau4 = 0.;
+   if (isEnabled(EFTOrders::YTAU4)) {
+      const double dlambdaytau4 = getThresholdCorrection(ThresholdVariables::LAMBDA_YTAU4, omitMSSMLogs);
+      dmh2ytau4 = isNaN(pow4(cbeta)*v2*(8
+         + dlambdaytau4 - 4*lmhtreeMt + 4*lmMt)/2.);
+   }
 
    // Loop factor
    const double k = 1/pow2(4.*Pi);
@@ -207,8 +268,6 @@ double himalaya::mh2_eft::Mh2EFTCalculator::getDeltaMh2EFT1Loop(int omitSMLogs,
  */
 double himalaya::mh2_eft::Mh2EFTCalculator::getDeltaMh2EFT2Loop(int omitSMLogs,
 								int omitMSSMLogs){
-   ThresholdCalculator thresholdCalculator(p, msq2);
-   
    using std::log;
    const double lmMt = omitSMLogs * log(pow2(p.scale / p.Mt));
    // couplings
@@ -235,83 +294,90 @@ double himalaya::mh2_eft::Mh2EFTCalculator::getDeltaMh2EFT2Loop(int omitSMLogs,
    // 2-Loop prefactor at*as
    const double pref = 1./pow4(4*Pi) * pow2(p.Mt * gt * p.g3);
    
-   // Threshold corrections
-   const double dytas = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::YT_AS, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdayb4g32 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YB4_G32, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdayb4 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YB4, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdayb6 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YB6, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdayb2g12 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YB2_G12, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdayb2g22 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YB2_G22, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdayt4 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_AT, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dytyt = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::YT_YT, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdayt6 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YT6, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dvyt2 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::VEV_YT2, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdaytau2g12 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YTAU2_G12, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdaytau2g22 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YTAU2_G12, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dytauytau = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::YTAU_YTAU, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdaytau4 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YTAU4, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdaytau6 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YTAU6, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdayt2yb4 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YT2_YB4, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdayt2g12 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YT2_G12, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdayt2g22 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YT2_G22, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dlambdayt4yb2 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::LAMBDA_YT4_YB2, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   const double dytyb = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::YT_YB, RenSchemes::DRBARPRIME, omitMSSMLogs);
-   
    // Corrections to Mh
-   const double dmh2yt4g32 = isNaN(orderMap.at(EFTOrders::G32YT4)*(pref*(96 * pow2(lmMt)
-      + (-32 + 48 * dytas) * lmMt - 24 * dytas
-      + thresholdCalculator.getThresholdCorrection(ThresholdVariables::LAMBDA_AT_AS,
-	 RenSchemes::DRBARPRIME, omitMSSMLogs))));
-   const double dmh2yb4g32 = isNaN(orderMap.at(EFTOrders::G32YB4)*(pow4(cbeta)
-      *(dlambdayb4g32 + 32*lmMt*(47 - 24*lmhtreeMt + 12*lmMt))*v2/2.));
-   const double dmh2yb6 = isNaN(orderMap.at(EFTOrders::YB6)*(pow6(cbeta)*v2*(29 + 2
-      *dlambdayb6 + 4*lmbMt*(-38 + 9*lmbMt) + 6*dlambdayb4*(-1 + lmhtreeMt - lmMt)
-      + 12*(-257 + 72*lmhtreeMt - 36*lmMt)*lmMt - 6*pow2(Pi) - 12*(dlambdayb2g12
-      *pow2(p.g1) + dlambdayb2g22*pow2(p.g2))*v2/pow2(mhtree))/4.));
-   const double dmh2yt6= isNaN(orderMap.at(EFTOrders::YT6)*(pow4(sbeta)*(24*dytyt*(-6
-      + dlambdayt4 + 12*lmMt) + 113*pow2(sbeta) + 6*(dlambdayt6 + dlambdayt4*(2
-      + 2*dvyt2 - 3*lmMt) - 3*(-2*pow2(lmbMt) - 8*dvyt2*(lmMt - 1) + 6*lmMt*(1
-      + 3*lmMt) + pow2(Pi))*pow2(sbeta))*v2)/12.));
-   const double dmh2yb4ytau2 = isNaN(orderMap.at(EFTOrders::YTAU2YB4)*(pow6(cbeta)*v2
-      *(dlambdayb4*(lmhtreeMt - 1 - lmMt)*pow2(mhtree) - 48*lmMt*(4 - 2*lmhtreeMt
-      + lmMt)*pow2(mhtree) - 6*(dlambdaytau2g12*pow2(p.g1) + dlambdaytau2g22
-      *pow2(p.g2)))*v2/(2*pow2(mhtree))));
+   double dmh2yt4g32 = 0.;
+   if (isEnabled(EFTOrders::G32YT4)) {
+      const double dytas = getThresholdCorrection(ThresholdVariables::YT_AS, omitMSSMLogs);
+      dmh2yt4g32 = isNaN(pref*(96 * pow2(lmMt)
+         + (-32 + 48 * dytas) * lmMt - 24 * dytas
+         + getThresholdCorrection(ThresholdVariables::LAMBDA_AT_AS, omitMSSMLogs)));
+   }
+   double dmh2yb4g32 = 0.;
+   if (isEnabled(EFTOrders::G32YB4)) {
+      const double dlambdayb4g32 = getThresholdCorrection(ThresholdVariables::LAMBDA_YB4_G32, omitMSSMLogs);
+      dmh2yb4g32 = isNaN(pow4(cbeta)
+         *(dlambdayb4g32 + 32*lmMt*(47 - 24*lmhtreeMt + 12*lmMt))*v2/2.);
+   }
+   double dmh2yb6 = 0.;
+   if (isEnabled(EFTOrders::YB6)) {
+      const double dlambdayb6 = getThresholdCorrection(ThresholdVariables::LAMBDA_YB6, omitMSSMLogs);
+      const double dlambdayb4 = getThresholdCorrection(ThresholdVariables::LAMBDA_YB4, omitMSSMLogs);
+      const double dlambdayb2g12 = getThresholdCorrection(ThresholdVariables::LAMBDA_YB2_G12, omitMSSMLogs);
+      const double dlambdayb2g22 = getThresholdCorrection(ThresholdVariables::LAMBDA_YB2_G22, omitMSSMLogs);
+      dmh2yb6 = isNaN(pow6(cbeta)*v2*(29 + 2
+         *dlambdayb6 + 4*lmbMt*(-38 + 9*lmbMt) + 6*dlambdayb4*(-1 + lmhtreeMt - lmMt)
+         + 12*(-257 + 72*lmhtreeMt - 36*lmMt)*lmMt - 6*pow2(Pi) - 12*(dlambdayb2g12
+         *pow2(p.g1) + dlambdayb2g22*pow2(p.g2))*v2/pow2(mhtree))/4.);
+   }
+   double dmh2yt6 = 0.;
+   if (isEnabled(EFTOrders::YT6)) {
+      const double dytyt = getThresholdCorrection(ThresholdVariables::YT_YT, omitMSSMLogs);
+      const double dlambdayt4 = getThresholdCorrection(ThresholdVariables::LAMBDA_AT, omitMSSMLogs);
+      const double dlambdayt6 = getThresholdCorrection(ThresholdVariables::LAMBDA_YT6, omitMSSMLogs);
+      const double dvyt2 = getThresholdCorrection(ThresholdVariables::VEV_YT2, omitMSSMLogs);
+      dmh2yt6 = isNaN(pow4(sbeta)*(24*dytyt*(-6
+         + dlambdayt4 + 12*lmMt) + 113*pow2(sbeta) + 6*(dlambdayt6 + dlambdayt4*(2
+         + 2*dvyt2 - 3*lmMt) - 3*(-2*pow2(lmbMt) - 8*dvyt2*(lmMt - 1) + 6*lmMt*(1
+         + 3*lmMt) + pow2(Pi))*pow2(sbeta))*v2)/12.);
+   }
+   double dmh2yb4ytau2 = 0.;
+   if (isEnabled(EFTOrders::YTAU2YB4)) {
+      const double dlambdayb4 = getThresholdCorrection(ThresholdVariables::LAMBDA_YB4, omitMSSMLogs);
+      const double dlambdaytau2g12 = getThresholdCorrection(ThresholdVariables::LAMBDA_YTAU2_G12, omitMSSMLogs);
+      const double dlambdaytau2g22 = getThresholdCorrection(ThresholdVariables::LAMBDA_YTAU2_G12, omitMSSMLogs);
+      dmh2yb4ytau2 = isNaN(pow6(cbeta)*v2
+         *(dlambdayb4*(lmhtreeMt - 1 - lmMt)*pow2(mhtree) - 48*lmMt*(4 - 2*lmhtreeMt
+         + lmMt)*pow2(mhtree) - 6*(dlambdaytau2g12*pow2(p.g1) + dlambdaytau2g22
+         *pow2(p.g2)))*v2/(2*pow2(mhtree)));
+   }
    const double dmh2yt4ytau2 = 0.;	//??
-   const double dmh2ytau6 = isNaN(orderMap.at(EFTOrders::YTAU6)*(pow4(cbeta)*v2*(12
-      *dytauytau*(8 + dlambdaytau4 - 4*lmhtreeMt + 4*lmMt) + pow2(cbeta)*(3
-      *dlambdaytau6 + 3*dlambdaytau4*(lmhtreeMt - 1 - lmMt) - 2*(6 + 15*lmMt
-      *(6 - 2*lmhtreeMt + lmMt) + 3*lmtauMt*(3*lmtauMt - 7) + pow2(Pi)) - 6
-      *(dlambdaytau2g12*pow2(p.g1) + dlambdaytau2g22*pow2(p.g2))*v2
-      /pow2(mhtree)))/6.));
-   const double dmh2yt2yb4 = isNaN(orderMap.at(EFTOrders::YT2YB4)*(pow4(cbeta)*pow2(
-      sbeta)*v2*(pow2(mhtree)*(dlambdayt2yb4 + dlambdayb4*(2 + 2*dvyt2 - 3*lmMt)
-      + 6*(-2*lmbMt + 3*(-9 + 6*lmhtreeMt - 4*lmMt)*lmMt + 4*dvyt2*(1 - lmMt
-      - lmMt) + 2*(5 + pow2(Pi)))) - 6*(dlambdayt2g12*pow2(p.g1) + dlambdayt2g22
-      *pow2(p.g2)*v2))/(2.*pow2(mhtree))));
-   const double dmh2yt4yb2 = isNaN(orderMap.at(EFTOrders::YB2YT4)*(pow4(sbeta)*v2*(4
-      *dytyb*(-6 + dlambdayt4 + 12*lmMt) + pow2(cbeta)*(dlambdayt4yb2 + 3
-      *dlambdayt4*(lmhtreeMt - 1 - lmMt) - 6*(5 + lmMt*(13 - 6*lmhtreeMt + 3
-      *lmMt) + 2*pow2(Pi))))/2.));
+   double dmh2ytau6 = 0.;
+   if (isEnabled(EFTOrders::YTAU6)) {
+      const double dytauytau = getThresholdCorrection(ThresholdVariables::YTAU_YTAU, omitMSSMLogs);
+      const double dlambdaytau4 = getThresholdCorrection(ThresholdVariables::LAMBDA_YTAU4, omitMSSMLogs);
+      const double dlambdaytau6 = getThresholdCorrection(ThresholdVariables::LAMBDA_YTAU6, omitMSSMLogs);
+      const double dlambdaytau2g12 = getThresholdCorrection(ThresholdVariables::LAMBDA_YTAU2_G12, omitMSSMLogs);
+      const double dlambdaytau2g22 = getThresholdCorrection(ThresholdVariables::LAMBDA_YTAU2_G12, omitMSSMLogs);
+      dmh2ytau6 = isNaN(pow4(cbeta)*v2*(12
+         *dytauytau*(8 + dlambdaytau4 - 4*lmhtreeMt + 4*lmMt) + pow2(cbeta)*(3
+         *dlambdaytau6 + 3*dlambdaytau4*(lmhtreeMt - 1 - lmMt) - 2*(6 + 15*lmMt
+         *(6 - 2*lmhtreeMt + lmMt) + 3*lmtauMt*(3*lmtauMt - 7) + pow2(Pi)) - 6
+         *(dlambdaytau2g12*pow2(p.g1) + dlambdaytau2g22*pow2(p.g2))*v2
+         /pow2(mhtree)))/6.);
+   }
+   double dmh2yt2yb4 = 0.;
+   if (isEnabled(EFTOrders::YT2YB4)) {
+      const double dlambdayt2yb4 = getThresholdCorrection(ThresholdVariables::LAMBDA_YT2_YB4, omitMSSMLogs);
+      const double dlambdayb4 = getThresholdCorrection(ThresholdVariables::LAMBDA_YB4, omitMSSMLogs);
+      const double dvyt2 = getThresholdCorrection(ThresholdVariables::VEV_YT2, omitMSSMLogs);
+      const double dlambdayt2g12 = getThresholdCorrection(ThresholdVariables::LAMBDA_YT2_G12, omitMSSMLogs);
+      const double dlambdayt2g22 = getThresholdCorrection(ThresholdVariables::LAMBDA_YT2_G22, omitMSSMLogs);
+      dmh2yt2yb4 = isNaN(pow4(cbeta)*pow2(
+         sbeta)*v2*(pow2(mhtree)*(dlambdayt2yb4 + dlambdayb4*(2 + 2*dvyt2 - 3*lmMt)
+         + 6*(-2*lmbMt + 3*(-9 + 6*lmhtreeMt - 4*lmMt)*lmMt + 4*dvyt2*(1 - lmMt
+         - lmMt) + 2*(5 + pow2(Pi)))) - 6*(dlambdayt2g12*pow2(p.g1) + dlambdayt2g22
+         *pow2(p.g2)*v2))/(2.*pow2(mhtree)));
+   }
+   double dmh2yt4yb2 = 0.;
+   if (isEnabled(EFTOrders::YB2YT4)) {
+      const double dytyb = getThresholdCorrection(ThresholdVariables::YT_YB, omitMSSMLogs);
+      const double dlambdayt4 = getThresholdCorrection(ThresholdVariables::LAMBDA_AT, omitMSSMLogs);
+      const double dlambdayt4yb2 = getThresholdCorrection(ThresholdVariables::LAMBDA_YT4_YB2, omitMSSMLogs);
+      dmh2yt4yb2 = isNaN(pow4(sbeta)*v2*(4
+         *dytyb*(-6 + dlambdayt4 + 12*lmMt) + pow2(cbeta)*(dlambdayt4yb2 + 3
+         *dlambdayt4*(lmhtreeMt - 1 - lmMt) - 6*(5 + lmMt*(13 - 6*lmhtreeMt + 3
+         *lmMt) + 2*pow2(Pi))))/2.);
+   }
    
    // Loop factor
    const double k2 = 1/pow4(4.*Pi);
@@ -330,21 +396,16 @@ double himalaya::mh2_eft::Mh2EFTCalculator::getDeltaMh2EFT2Loop(int omitSMLogs,
 double himalaya::mh2_eft::Mh2EFTCalculator::getDeltaMh2EFT3Loop(int omitSMLogs,
 								int omitMSSMLogs,
 								int omitDeltaLambda3L){
-   ThresholdCalculator thresholdCalculator(p, msq2);
-   
    using std::log;
    
    const double catas2 = 248.1215180432007;
    const double lmMt = omitSMLogs * log(pow2(p.scale / p.Mt));
    // threshold correction of yt_as DRbar'
-   const double dytas = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::YT_AS, RenSchemes::DRBARPRIME, omitMSSMLogs);
+   const double dytas = getThresholdCorrection(ThresholdVariables::YT_AS, omitMSSMLogs);
    // threshold correction of yt_as2 DRbar'
-   const double dytas2 = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::YT_AS2, RenSchemes::DRBARPRIME, omitMSSMLogs);
+   const double dytas2 = getThresholdCorrection(ThresholdVariables::YT_AS2, omitMSSMLogs);
    // threshold correction of g3_as DRbar'
-   const double dg3as = thresholdCalculator.getThresholdCorrection(
-      ThresholdVariables::G3_AS, RenSchemes::DRBARPRIME, omitMSSMLogs);
+   const double dg3as = getThresholdCorrection(ThresholdVariables::G3_AS, omitMSSMLogs);
    
    const double gt = sqrt(2)*p.Mt/std::sqrt(pow2(p.vu) + pow2(p.vd));
    
@@ -355,9 +416,7 @@ double himalaya::mh2_eft::Mh2EFTCalculator::getDeltaMh2EFT3Loop(int omitSMLogs,
       + (-128 * zt3 - 2056 / 3. + -64 * dg3as - 512 * dytas + 72 * pow2(dytas)
       + 48 * dytas2) * lmMt + 64 * dytas - 84 * pow2(dytas) - 24 * dytas2
       + catas2
-      + omitDeltaLambda3L*thresholdCalculator.getThresholdCorrection(
-	 ThresholdVariables::LAMBDA_AT_AS2,
-	 RenSchemes::DRBARPRIME, omitMSSMLogs));
+      + omitDeltaLambda3L*getThresholdCorrection(ThresholdVariables::LAMBDA_AT_AS2, omitMSSMLogs));
 }
 
 /**
@@ -8,7 +8,7 @@
 #include "ThresholdCalculator.hpp"
 #include "Hierarchies.hpp"
 #include "Logger.hpp"
-#include "dilog.h"
+#include "Polylog.hpp"
 #include <cmath>
 
 namespace {
@@ -45,13 +45,14 @@ namespace {
    double phi_pos(double u, double v)
    {
       using std::log;
-      using gm2calc::dilog;
       const auto lambda = std::sqrt(lambda_2(u,v));
+      const double args[2] = {(1 - lambda + u - v)/2., (1 - lambda - u + v)/2.};
+      const auto li2 = himalaya::dilog(himalaya::SimdPack<2>::load(args));
 
       return (-(log(u)*log(v))
-              + 2*log((1 - lambda + u - v)/2.)*log((1 - lambda - u + v)/2.)
-              - 2*dilog((1 - lambda + u - v)/2.)
-              - 2*dilog((1 - lambda - u + v)/2.)
+              + 2*log(args[0])*log(args[1])
+              - 2*li2[0]
+              - 2*li2[1]
               + pow2(Pi)/3.)/lambda;
    }
 
@@ -60,12 +61,18 @@ namespace {
    {
       using std::acos;
       using std::sqrt;
-      using gm2calc::clausen_2;
       const auto lambda = std::sqrt(-lambda_2(u,v));
+      const double args[4] = {
+         2*acos((1 + u - v)/(2.*sqrt(u))),
+         2*acos((1 - u + v)/(2.*sqrt(v))),
+         2*acos((-1 + u + v)/(2.*sqrt(u*v))),
+         0.
+      };
+      const auto cl2 = himalaya::clausen_2(himalaya::SimdPack<4>::load(args));
 
-      return 2*(+ clausen_2(2*acos((1 + u - v)/(2.*sqrt(u))))
-                + clausen_2(2*acos((1 - u + v)/(2.*sqrt(v))))
-                + clausen_2(2*acos((-1 + u + v)/(2.*sqrt(u*v)))))/lambda;
+      return 2*(+ cl2[0]
+                + cl2[1]
+                + cl2[2])/lambda;
    }
 
    /**
@@ -101,68 +108,75 @@ namespace {
  */
 himalaya::ThresholdCalculator::ThresholdCalculator(
    const Parameters& p_, double msq2_, bool verbose, bool check)
-   : p(p_), msq2(msq2_)
+   : p(p_), msq2(msq2_), limitDetermined(check)
 {
    p.validate(verbose);
 
    if (!std::isfinite(msq2_))
       msq2 = p.calculateMsq2();
+}
 
-   if(!check){
-      // Set mass limit for threshold corrections
-      const double mQ3 = sqrt(p.mq2(2,2));
-      const double mU3 = sqrt(p.mu2(2,2));
-      const double m3 = p.MG;
-      const double eps = mQ3*0.01;
-      const double eps2 = mU3*0.01;
-      const double msq2Save = msq2;
-      const double Pi  = 3.1415926535897932384626433832795;
-      const double v = sqrt(pow2(p.vu) + pow2(p.vd));
-      const double pref = sqrt(2.)*p.Mt*pow4(p.g3/(4*Pi))/v;
+/**
+ * 	Determines the mass limit of the threshold corrections, which is done
+ * 	once at the first request of a limit dependent threshold correction
+ */
+void himalaya::ThresholdCalculator::determineLimit(){
+   limitDetermined = true;
 
-      if(std::abs(mQ3-mU3) < eps && std::abs(mU3 - m3) < eps && std::abs(m3 - sqrt(msq2)) < eps){
-	 const double lim = pref*getDeltaYtAlphas2(Limits::DEGENERATE, 1);
-	 const double exact = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
-	 p.mu2(2,2) = pow2(mQ3 + std::abs(mU3 - mQ3)/2.);
-	 p.MG = mQ3 + std::abs(m3 - mQ3)/2.;
-	 msq2 = pow2(mQ3 + std::abs(sqrt(msq2) - mQ3)/2.);
-	 const double exactShifted = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
-	 if(!isfinite(exact, exactShifted, lim)) p.massLimit3LThreshold = Limits::DEGENERATE;
-      } else if(std::abs(mQ3 - mU3) < eps && std::abs(mU3 - m3) < eps){
-	 const double lim = pref*getDeltaYtAlphas2(Limits::MQ3_EQ_MU3_EQ_M3, 1);
-	 const double exact = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
-	 p.mu2(2,2) = pow2(mQ3 + std::abs(mU3 - mQ3)/2.);
-	 p.MG = mQ3 + std::abs(m3 - mQ3)/2.;
-	 const double exactShifted = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
-	 if(!isfinite(exact, exactShifted, lim)) p.massLimit3LThreshold = Limits::MQ3_EQ_MU3_EQ_M3;
-      } else if(std::abs(mQ3 - mU3) < eps){
-	 const double lim = pref*getDeltaYtAlphas2(Limits::MQ3_EQ_MU3, 1);
-	 const double exact = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
-	 p.mu2(2,2) = pow2(mQ3 + std::abs(mU3 - mQ3)/2.);
-	 p.MG = mQ3 + std::abs(m3 - mQ3)/2.;
-	 const double exactShifted = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
-	 if(!isfinite(exact, exactShifted, lim)) p.massLimit3LThreshold = Limits::MQ3_EQ_MU3;
-      } else if(std::abs(mQ3 - m3) < eps){
-	 const double lim = pref*getDeltaYtAlphas2(Limits::MQ3_EQ_M3, 1);
-	 const double exact = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
-	 p.mu2(2,2) = pow2(mQ3 + std::abs(mU3 - mQ3)/2.);
-	 p.MG = mQ3 + std::abs(m3 - mQ3)/2.;
-	 const double exactShifted = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
-	 if(!isfinite(exact, exactShifted, lim)) p.massLimit3LThreshold = Limits::MQ3_EQ_M3;
-      } else if(std::abs(mU3 - m3) < eps2){
-	 const double lim = pref*getDeltaYtAlphas2(Limits::MU3_EQ_M3, 1);
-	 const double exact = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
-	 p.mu2(2,2) = pow2(mQ3 + std::abs(mU3 - mQ3)/2.);
-	 p.MG = mQ3 + std::abs(m3 - mQ3)/2.;
-	 const double exactShifted = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
-	 if(!isfinite(exact, exactShifted, lim)) p.massLimit3LThreshold = Limits::MU3_EQ_M3;
-      }
+   // Set mass limit for threshold corrections
+   const double mQ3 = sqrt(p.mq2(2,2));
+   const double mU3 = sqrt(p.mu2(2,2));
+   const double m3 = p.MG;
+   const double eps = mQ3*0.01;
+   const double eps2 = mU3*0.01;
+   const double msq2Save = msq2;
+   const double mU32Save = p.mu2(2,2);
+   const double Pi  = 3.1415926535897932384626433832795;
+   const double v = sqrt(pow2(p.vu) + pow2(p.vd));
+   const double pref = sqrt(2.)*p.Mt*pow4(p.g3/(4*Pi))/v;
 
-      // reset possible parameter shifts
-      p.mu2(2,2) = pow2(mU3);
-      p.MG = m3;
-      msq2 = msq2Save;
+   if(std::abs(mQ3-mU3) < eps && std::abs(mU3 - m3) < eps && std::abs(m3 - sqrt(msq2)) < eps){
+      const double lim = pref*getDeltaYtAlphas2(Limits::DEGENERATE, 1);
+      const double exact = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
+      p.mu2(2,2) = pow2(mQ3 + std::abs(mU3 - mQ3)/2.);
+      p.MG = mQ3 + std::abs(m3 - mQ3)/2.;
+      msq2 = pow2(mQ3 + std::abs(sqrt(msq2) - mQ3)/2.);
+      const double exactShifted = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
+      if(!isfinite(exact, exactShifted, lim)) p.massLimit3LThreshold = Limits::DEGENERATE;
+   } else if(std::abs(mQ3 - mU3) < eps && std::abs(mU3 - m3) < eps){
+      const double lim = pref*getDeltaYtAlphas2(Limits::MQ3_EQ_MU3_EQ_M3, 1);
+      const double exact = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
+      p.mu2(2,2) = pow2(mQ3 + std::abs(mU3 - mQ3)/2.);
+      p.MG = mQ3 + std::abs(m3 - mQ3)/2.;
+      const double exactShifted = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
+      if(!isfinite(exact, exactShifted, lim)) p.massLimit3LThreshold = Limits::MQ3_EQ_MU3_EQ_M3;
+   } else if(std::abs(mQ3 - mU3) < eps){
+      const double lim = pref*getDeltaYtAlphas2(Limits::MQ3_EQ_MU3, 1);
+      const double exact = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
+      p.mu2(2,2) = pow2(mQ3 + std::abs(mU3 - mQ3)/2.);
+      p.MG = mQ3 + std::abs(m3 - mQ3)/2.;
+      const double exactShifted = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
+      if(!isfinite(exact, exactShifted, lim)) p.massLimit3LThreshold = Limits::MQ3_EQ_MU3;
+   } else if(std::abs(mQ3 - m3) < eps){
+      const double lim = pref*getDeltaYtAlphas2(Limits::MQ3_EQ_M3, 1);
+      const double exact = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
+      p.mu2(2,2) = pow2(mQ3 + std::abs(mU3 - mQ3)/2.);
+      p.MG = mQ3 + std::abs(m3 - mQ3)/2.;
+      const double exactShifted = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
+      if(!isfinite(exact, exactShifted, lim)) p.massLimit3LThreshold = Limits::MQ3_EQ_M3;
+   } else if(std::abs(mU3 - m3) < eps2){
+      const double lim = pref*getDeltaYtAlphas2(Limits::MU3_EQ_M3, 1);
+      const double exact = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
+      p.mu2(2,2) = pow2(mQ3 + std::abs(mU3 - mQ3)/2.);
+      p.MG = mQ3 + std::abs(m3 - mQ3)/2.;
+      const double exactShifted = pref*getDeltaYtAlphas2(Limits::GENERAL, 1);
+      if(!isfinite(exact, exactShifted, lim)) p.massLimit3LThreshold = Limits::MU3_EQ_M3;
    }
+
+   // reset possible parameter shifts
+   p.mu2(2,2) = mU32Save;
+   p.MG = m3;
+   msq2 = msq2Save;
 }
 
 bool himalaya::ThresholdCalculator::isfinite(double exact, double shifted, double limit){
@@ -186,7 +200,6 @@ bool himalaya::ThresholdCalculator::isfinite(double exact, double shifted, doubl
  */
 double himalaya::ThresholdCalculator::getThresholdCorrection(int variable, int scheme, int omitLogs){
    double thresholdCorrection = 0.;
-   const double limit = p.massLimit3LThreshold;
    
    if(scheme != RenSchemes::TEST && scheme != RenSchemes::DRBARPRIME){
       INFO_MSG("Your renormalization scheme is not compatible with the"
@@ -204,6 +217,7 @@ double himalaya::ThresholdCalculator::getThresholdCorrection(int variable, int s
       }
       break;
       case(ThresholdVariables::YT_AS):{
+	 const int limit = getLimit();
 	 thresholdCorrection = getDeltaYtAlphas(limit, omitLogs);
 	 switch(scheme){
 	    case(RenSchemes::DRBARPRIME):
@@ -213,6 +227,7 @@ double himalaya::ThresholdCalculator::getThresholdCorrection(int variable, int s
       }
       break;
       case(ThresholdVariables::YT_AS2):{
+	 const int limit = getLimit();
 	 thresholdCorrection = getDeltaYtAlphas2(limit, omitLogs);
 	 switch(scheme){
 	    case(RenSchemes::DRBARPRIME):{
@@ -225,10 +240,12 @@ double himalaya::ThresholdCalculator::getThresholdCorrection(int variable, int s
       }
       break;
       case(ThresholdVariables::LAMBDA_AT):{
+	 const int limit = getLimit();
 	 thresholdCorrection = getDeltaLambdaAlphat(limit, omitLogs);
       }
       break;
       case(ThresholdVariables::LAMBDA_AT_AS):{
+	 const int limit = getLimit();
 	 thresholdCorrection = getDeltaLambdaAlphatAlphas(limit, omitLogs);
 	 switch(scheme){
 	    case(RenSchemes::DRBARPRIME):
@@ -242,6 +259,7 @@ double himalaya::ThresholdCalculator::getThresholdCorrection(int variable, int s
       // Note that the genuine contribution of lambda_atas2 is unknown and thus set to 0 (note: here are the reconstructed DR' logs included)
       // The lines below just convert it from MSbar to DRbar
       case(ThresholdVariables::LAMBDA_AT_AS2):{
+	 const int limit = getLimit();
 	 thresholdCorrection = getDeltaLambdaAlphatAlphas2(limit, omitLogs);
 	 switch(scheme){
 	    case(RenSchemes::DRBARPRIME):{
@@ -315,7 +333,7 @@ double himalaya::ThresholdCalculator::getThresholdCorrection(int variable, int s
 	 return getDeltaG2G2(omitLogs);
       }
       case(ThresholdVariables::VEV_YT2):{
-	 return getDeltaVevYt2(limit);
+	 return getDeltaVevYt2(getLimit());
       }
       case(ThresholdVariables::YT_YB):{
 	 return getDeltaYtYb(omitLogs);
@@ -349,6 +367,113 @@ double himalaya::ThresholdCalculator::getThresholdCorrection(int variable, int s
    return thresholdCorrection;
 }
 
+/**
+ * 	Returns all threshold corrections for the suitable mass limit, which are calculated in one sweep
+ * 	@param scheme an integer key to set the scheme. Choices are {DRbar'} only!
+ * 	@param omitLogs an integer to omit all log mu terms
+ * 	@return all threshold corrections, which are equal to the ones of getThresholdCorrection
+ */
+himalaya::ThresholdCorrections himalaya::ThresholdCalculator::getThresholdCorrections(int scheme, int omitLogs){
+   using namespace ThresholdVariables;
+
+   if(scheme != RenSchemes::TEST && scheme != RenSchemes::DRBARPRIME){
+      INFO_MSG("Your renormalization scheme is not compatible with the"
+               " implemented threshold corrections!");
+   }
+
+   const int limit = getLimit();
+
+   // the MSbar corrections at O(alpha_t*alpha_s^n), which enter several threshold corrections
+   const double dg3as = getDeltaG3Alphas(omitLogs);
+   const double dytas = getDeltaYtAlphas(limit, omitLogs);
+   const double dytas2 = getDeltaYtAlphas2(limit, omitLogs);
+   const double dlambdaat = getDeltaLambdaAlphat(limit, omitLogs);
+   const double dlambdaatas = getDeltaLambdaAlphatAlphas(limit, omitLogs);
+   const double dlambdaatas2 = getDeltaLambdaAlphatAlphas2(limit, omitLogs);
+
+   ThresholdCorrections thresholdCorrections;
+   auto& c = thresholdCorrections.corrections;
+
+   c[G3_AS] = dg3as;
+   c[YT_AS] = dytas;
+   c[YT_AS2] = dytas2;
+   c[LAMBDA_AT] = dlambdaat;
+   c[LAMBDA_AT_AS] = dlambdaatas;
+   c[LAMBDA_AT_AS2] = dlambdaatas2;
+
+   // conversion to the DRbar' scheme, see getThresholdCorrection
+   if(scheme == RenSchemes::DRBARPRIME){
+      c[G3_AS] = - dg3as;
+      c[YT_AS] = - dytas;
+      c[YT_AS2] = 2 * dg3as * dytas + pow2(dytas) - dytas2;
+      c[LAMBDA_AT_AS] = dlambdaatas - 4 * dlambdaat * dytas;
+      c[LAMBDA_AT_AS2] = dlambdaatas2 + (dlambdaatas * (-2 * dg3as - 4 * dytas)
+	 + dlambdaat * (8 * dg3as * dytas + 10 * pow2(dytas) - 4 * dytas2));
+   }
+
+   c[LAMBDA_YB2_G12] = getDeltaLambdaYb2G12(omitLogs);
+   c[LAMBDA_G14] = getDeltaLambdaG14(omitLogs);
+   c[LAMBDA_REG_G14] = getDeltaLambdaRegG14();
+   c[LAMBDA_CHI_G14] = getDeltaLambdaChiG14(omitLogs);
+   c[LAMBDA_CHI_G24] = getDeltaLambdaChiG24(omitLogs);
+   c[LAMBDA_G24] = getDeltaLambdaG24(omitLogs);
+   c[LAMBDA_REG_G24] = getDeltaLambdaRegG24();
+   c[LAMBDA_G12_G22] = getDeltaLambdaG12G22(omitLogs);
+   c[LAMBDA_REG_G12_G22] = getDeltaLambdaRegG12G22();
+   c[LAMBDA_CHI_G12_G22] = getDeltaLambdaChiG12G22();
+   c[LAMBDA_YB2_G22] = getDeltaLambdaYb2G22(omitLogs);
+   c[LAMBDA_YB4] = getDeltaLambdaYb4(omitLogs);
+   c[LAMBDA_YT2_G12] = getDeltaLambdaYt2G12(omitLogs);
+   c[LAMBDA_YT2_G22] = getDeltaLambdaYt2G22(omitLogs);
+   c[LAMBDA_YTAU2_G12] = getDeltaLambdaYtau2G12(omitLogs);
+   c[LAMBDA_YTAU2_G22] = getDeltaLambdaYtau2G22(omitLogs);
+   c[LAMBDA_YTAU4] = getDeltaLambdaYtau4(omitLogs);
+   c[G1_G1] = getDeltaG1G1(omitLogs);
+   c[G2_G2] = getDeltaG2G2(omitLogs);
+   c[VEV_YT2] = getDeltaVevYt2(limit);
+   c[YT_YB] = getDeltaYtYb(omitLogs);
+   c[YT_YT] = getDeltaYtYt(omitLogs);
+   c[YTAU_YTAU] = getDeltaYtauYtau(omitLogs);
+   c[LAMBDA_YB4_G32] = getDeltaLambdaYb4G32(omitLogs);
+   c[LAMBDA_YB6] = getDeltaLambdaYb6(omitLogs);
+   c[LAMBDA_YT6] = getDeltaLambdaYt6(omitLogs);
+   c[LAMBDA_YTAU6] = getDeltaLambdaYtau6(omitLogs);
+   c[LAMBDA_YT2_YB4] = getDeltaLambdaYt2Yb4(omitLogs);
+   c[LAMBDA_YT4_YB2] = getDeltaLambdaYt4Yb2(omitLogs);
+
+   return thresholdCorrections;
+}
+
+/**
+ * 	Returns all threshold corrections as polynomials in log(mu^2/Mst1^2) at fixed masses and couplings
+ * 	@param scheme an integer key to set the scheme. Choices are {DRbar'} only!
+ * 	@param omitLogs an integer to omit all log mu terms
+ * 	@return the coefficients of the threshold corrections, indexed by the ThresholdVariables
+ */
+std::array<himalaya::LogCoefficients<double>, himalaya::ThresholdVariables::NUMBER_OF_THRESHOLD_VARIALES>
+   himalaya::ThresholdCalculator::getThresholdCorrectionLogCoefficients(int scheme, int omitLogs){
+   // the threshold corrections are polynomials of at most third degree in the logarithm,
+   // which are interpolated from their values at four renormalization scales
+   std::array<ThresholdCorrections, 4> nodes;
+   for (int i = 0; i < 4; i++) {
+      Parameters q = p;
+      q.scale = p.MSt(0) * std::exp(getLogNode(i) / 2.);
+      ThresholdCalculator tc(q, msq2, false);
+      // the mass limit is kept fixed as the masses
+      tc.setLimit(getLimit());
+      nodes[i] = tc.getThresholdCorrections(scheme, omitLogs);
+   }
+
+   std::array<LogCoefficients<double>, ThresholdVariables::NUMBER_OF_THRESHOLD_VARIALES> coefficients;
+   for (int variable = ThresholdVariables::FIRST;
+	variable < ThresholdVariables::NUMBER_OF_THRESHOLD_VARIALES; variable++) {
+      coefficients[variable] = interpolateLogCoefficients<double>(
+	 {{nodes[0][variable], nodes[1][variable], nodes[2][variable], nodes[3][variable]}});
+   }
+
+   return coefficients;
+}
+
 double himalaya::ThresholdCalculator::getDeltaLambdaYb2G12(int omitLogs){
    using std::log;
    using std::sqrt;
@@ -748,7 +873,7 @@ double himalaya::ThresholdCalculator::getDeltaVevYt2(int limit){
 double himalaya::ThresholdCalculator::getDeltaLambdaYb4G32(int omitLogs){
    using std::log;
    using std::sqrt;
-   using gm2calc::dilog;
+   using himalaya::dilog;
    
    const double MR2 = pow2(p.scale);
    const double lMR = omitLogs*log(MR2);
@@ -825,7 +950,7 @@ double himalaya::ThresholdCalculator::getDeltaLambdaYb4G32(int omitLogs){
 double himalaya::ThresholdCalculator::getDeltaLambdaYb6(int omitLogs){
    using std::log;
    using std::sqrt;
-   using gm2calc::dilog;
+   using himalaya::dilog;
 
    
    const double MR2 = pow2(p.scale);
@@ -1086,7 +1211,7 @@ double himalaya::ThresholdCalculator::getDeltaLambdaYb6(int omitLogs){
 double himalaya::ThresholdCalculator::getDeltaLambdaYt6(int omitLogs){
    using std::log;
    using std::sqrt;
-   using gm2calc::dilog;
+   using himalaya::dilog;
    
    const double MR2 = pow2(p.scale);
    const double lMR = omitLogs*log(MR2);
@@ -1422,7 +1547,7 @@ double himalaya::ThresholdCalculator::getDeltaLambdaYt6(int omitLogs){
 double himalaya::ThresholdCalculator::getDeltaLambdaYtau6(int omitLogs){
    using std::log;
    using std::sqrt;
-   using gm2calc::dilog;
+   using himalaya::dilog;
    
    const double MR2 = pow2(p.scale);
    const double lMR = omitLogs*log(MR2);
@@ -1819,7 +1944,7 @@ double himalaya::ThresholdCalculator::getDeltaLambdaYtau6(int omitLogs){
 double himalaya::ThresholdCalculator::getDeltaLambdaYt2Yb4(int omitLogs){
    using std::log;
    using std::sqrt;
-   using gm2calc::dilog;
+   using himalaya::dilog;
    
    const double MR2 = pow2(p.scale);
    const double lMR = omitLogs*log(MR2);
@@ -2330,7 +2455,7 @@ double himalaya::ThresholdCalculator::getDeltaLambdaYt2Yb4(int omitLogs){
 double himalaya::ThresholdCalculator::getDeltaLambdaYt4Yb2(int omitLogs){
    using std::log;
    using std::sqrt;
-   using gm2calc::dilog;
+   using himalaya::dilog;
    
    const double MR2 = pow2(p.scale);
    const double lMR = omitLogs*log(MR2);
@@ -3207,7 +3332,7 @@ double himalaya::ThresholdCalculator::getDeltaYtAlphas(int limit, int omitLogs){
 double himalaya::ThresholdCalculator::getDeltaYtAlphas2(int limit, int omitLogs){
    using std::log;
    using std::sqrt;
-   using gm2calc::dilog;
+   using himalaya::dilog;
 
    const double Mst12 = pow2(p.MSt(0));
    const double m32 = pow2(p.MG);
@@ -3674,7 +3799,7 @@ double himalaya::ThresholdCalculator::getDeltaLambdaAlphat(int limit, int omitLo
 double himalaya::ThresholdCalculator::getDeltaLambdaAlphatAlphas(int limit, int omitLogs){
    using std::log;
    using std::sqrt;
-   using gm2calc::dilog;
+   using himalaya::dilog;
    
    const double Mst12 = pow2(p.MSt(0));
    const double m32 = pow2(p.MG);
@@ -3845,7 +3970,7 @@ double himalaya::ThresholdCalculator::getDeltaLambdaAlphatAlphas2(int limit, int
 
    using std::log;
    using std::sqrt;
-   using gm2calc::dilog;
+   using himalaya::dilog;
    
    const double Mst12 = pow2(p.MSt(0));
    const double m32 = pow2(p.MG);
@@ -4282,26 +4407,50 @@ double himalaya::ThresholdCalculator::getDeltaLambdaAlphatAlphas2(int limit, int
  * 	@param omitXtLogs an integer key to omit all Xt^4*Log[mu] and Xt^5*Log[mu] terms
  */
 double himalaya::ThresholdCalculator::getDRbarPrimeToMSbarShift(int xtOrder, int omitLogs, int omitXtLogs){
+   const int limit = getLimit();
    double xtTerms = 0.;
    if(xtOrder <= 3){
-      xtTerms = getDRbarPrimeToMSbarXtTerms(p.massLimit3LThreshold, 4, omitXtLogs)
-	 + getDRbarPrimeToMSbarXtTerms(p.massLimit3LThreshold, 5, omitXtLogs)
-	 + getDRbarPrimeToMSbarXtTerms(p.massLimit3LThreshold, 6, omitXtLogs);
+      xtTerms = getDRbarPrimeToMSbarXtTerms(limit, 4, omitXtLogs)
+	 + getDRbarPrimeToMSbarXtTerms(limit, 5, omitXtLogs)
+	 + getDRbarPrimeToMSbarXtTerms(limit, 6, omitXtLogs);
    } else{
-      xtTerms = getDRbarPrimeToMSbarXtTerms(p.massLimit3LThreshold, 5, omitXtLogs)
-	 + getDRbarPrimeToMSbarXtTerms(p.massLimit3LThreshold, 6, omitXtLogs);
+      xtTerms = getDRbarPrimeToMSbarXtTerms(limit, 5, omitXtLogs)
+	 + getDRbarPrimeToMSbarXtTerms(limit, 6, omitXtLogs);
    }
 
    const double g3as = getDeltaG3Alphas(omitLogs);
-   const double ytas = getDeltaYtAlphas(p.massLimit3LThreshold, omitLogs);
-   const double ytas2 = getDeltaYtAlphas2(p.massLimit3LThreshold, omitLogs);
-   const double lambdaat = getDeltaLambdaAlphat(p.massLimit3LThreshold, omitLogs);
-   const double lambdaatas = getDeltaLambdaAlphatAlphas(p.massLimit3LThreshold, omitLogs);
+   const double ytas = getDeltaYtAlphas(limit, omitLogs);
+   const double ytas2 = getDeltaYtAlphas2(limit, omitLogs);
+   const double lambdaat = getDeltaLambdaAlphat(limit, omitLogs);
+   const double lambdaatas = getDeltaLambdaAlphatAlphas(limit, omitLogs);
 
    return -(-2.*(lambdaat*(3*pow2(ytas) + 2*ytas2) + (lambdaatas - 4*ytas*lambdaat)
       *(g3as + 2*ytas)) - xtTerms);
 }
 
+/**
+ * 	Returns the shift needed to convert the 3L threshold correction of lambda to the MSbar scheme as a polynomial in Xt
+ * 	@param xtOrder an integer key to omit the Xt contributions starting at xtOrder + 1
+ * 	@param omitLogs an integer key to omit all log mu terms
+ * 	@param omitXtLogs an integer key to omit all Xt^4*Log[mu] and Xt^5*Log[mu] terms
+ */
+himalaya::XtPolynomial himalaya::ThresholdCalculator::getDRbarPrimeToMSbarShiftXtPolynomial(int xtOrder, int omitLogs, int omitXtLogs){
+   // the mass limit is kept fixed as the masses
+   const int limit = getLimit();
+   const double range = 3. * sqrt(sqrt(p.mq2(2,2) * p.mu2(2,2)));
+
+   // the shift is interpolated from its values at XtPolynomial::degree + 1 values of Xt
+   std::array<double, XtPolynomial::degree + 1> nodes;
+   for (int i = 0; i <= XtPolynomial::degree; i++) {
+      ThresholdCalculator tc(*this);
+      tc.p.Au(2,2) = getXtNode(i, range) + p.mu * p.vd / p.vu;
+      tc.setLimit(limit);
+      nodes[i] = tc.getDRbarPrimeToMSbarShift(xtOrder, omitLogs, omitXtLogs);
+   }
+
+   return interpolateXtPolynomial(nodes, range);
+}
+
 /**
  * 	Returns the DRbarPrime to MSbar shift of delta lambda 3L at a given xtOrder
  * 	@param limit an integer key for a mass limit
@@ -4312,7 +4461,7 @@ double himalaya::ThresholdCalculator::getDRbarPrimeToMSbarXtTerms(int limit, int
    
    using std::log;
    using std::sqrt;
-   using gm2calc::dilog;
+   using himalaya::dilog;
    
    const int omitXt4 = xtOrder != 4 ? 0 : 1;
    const int omitXt5 = xtOrder != 5 ? 0 : 1;
@@ -5764,18 +5913,21 @@ double himalaya::ThresholdCalculator::getDRbarPrimeToMSbarXtTerms(int limit, int
 
 
 /**
- * 	Sets the mass limit to check terms
+ * 	Sets the mass limit of the threshold corrections, which skips the determination of the mass limit
  * 	@param limit an integer key for a mass limit
  */
 void himalaya::ThresholdCalculator::setLimit(int limit){
    p.massLimit3LThreshold = limit;
+   limitDetermined = true;
 }
 
 /**
- * 	Get the mass limit determined by ThresholdCalculator
+ * 	Get the mass limit determined by ThresholdCalculator, which is determined at the first call
  * 	@return The determined mass limit
  */
 int himalaya::ThresholdCalculator::getLimit(){
+   if(!limitDetermined) determineLimit();
+
    return p.massLimit3LThreshold;
 }
 
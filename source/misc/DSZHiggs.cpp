@@ -0,0 +1,444 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+// C++ port of the Fortran routines in mh2l/DSZHiggs.f and mh2l/functs.f
+// by P. Slavich, based on G. Degrassi, P. Slavich and F. Zwirner,
+// Nucl. Phys. B611 (2001) 403 [hep-ph/0105096].  The expressions and
+// the order of the operations follow the Fortran code, which is kept as
+// a reference.  The dilogarithms are evaluated by dilog and clausen_2 of
+// Polylog.hpp instead of the complex routine CSPEN.
+
+#include "DSZHiggs.hpp"
+#include "Polylog.hpp"
+#include <cmath>
+#include <cstddef>
+
+namespace himalaya {
+namespace mh2l {
+
+namespace {
+
+template <typename T>
+T pow2(T x) { return x*x; }
+
+/// function Omega(a,b) of myB0
+double Omega(double a, double b)
+{
+   double Cbig = (a + b)/2. - pow2(a - b)/4. - 1./4.;
+
+   if (Cbig > 0.) {
+      return std::sqrt(Cbig)*
+         (std::atan((1. + a - b)/(2.*std::sqrt(Cbig))) +
+          std::atan((1. - a + b)/(2.*std::sqrt(Cbig))));
+   } else if (Cbig < 0.) {
+      Cbig = -Cbig;
+      return 1./2.*std::sqrt(Cbig)*
+         std::log((a/2. + b/2. - 1./2. - std::sqrt(Cbig))/
+                  (a/2. + b/2. - 1./2. + std::sqrt(Cbig)));
+   }
+
+   return 0.;
+}
+
+/// real part of the Passarino-Veltman function B0, from Degrassi and Sirlin, Phys. Rev. D46 (1992) 3104
+double myB0(double q, double m1, double m2, double mu2)
+{
+   if (q == 0.) {
+      if (m1 == 0. && m2 != 0.)
+         return 1. - std::log(m2/mu2);
+      if (m1 != 0. && m2 == 0.)
+         return 1. - std::log(m1/mu2);
+      if (m1 == m2)
+         return -std::log(m1/mu2);
+      return 1. - std::log(m2/mu2) + m1/(m1 - m2)*std::log(m2/m1);
+   }
+
+   if (m1 == 0. && m2 != 0.) {
+      if (m2 != q)
+         return -(std::log(m2/mu2) - 2 - (m2/q - 1.)*std::log(std::abs(1. - q/m2)));
+      return -(std::log(m2/mu2) - 2);
+   }
+
+   if (m2 == 0. && m1 != 0.) {
+      if (m1 != q)
+         return -(std::log(m1/mu2) - 2 - (m1/q - 1.)*std::log(std::abs(1. - q/m1)));
+      return -(std::log(m1/mu2) - 2);
+   }
+
+   if (m2 == 0. && m1 == 0.)
+      return -(std::log(q/mu2) - 2); // cut the imaginary part (I Pi)
+
+   return -(std::log(q/mu2) - 2. +
+            1./2.*(1. + (m1/q - m2/q))*std::log(m1/q) +
+            1./2.*(1. - (m1/q - m2/q))*std::log(m2/q) +
+            2.*Omega(m1/q, m2/q));
+}
+
+/// function phi(x,y,z) for z >= x, y, eq. (A4) of DSZ
+double myphi(double x, double y, double z)
+{
+   const double Pi = 3.14159265358979;
+
+   const double u = x/z;
+   const double v = y/z;
+
+   if (u <= 1e-8) {
+      if (v != 1.)
+         return (std::log(u)*std::log(v) + 2.*dilog(1. - v))/(1. - v);
+      return 2. - std::log(u);
+   }
+
+   if (v <= 1e-8) {
+      if (u != 1.)
+         return (std::log(v)*std::log(u) + 2.*dilog(1. - u))/(1. - u);
+      return 2. - std::log(v);
+   }
+
+   if (pow2(1. - u - v) >= 4.*u*v) {
+      const double lam = std::sqrt(pow2(1. - u - v) - 4.*u*v);
+      const double xp = (1. + (u - v) - lam)/2.;
+      const double xm = (1. - (u - v) - lam)/2.;
+
+      return (2.*std::log(xp)*std::log(xm) - std::log(u)*std::log(v) -
+              2.*(dilog(xp) + dilog(xm)) + pow2(Pi)/3.)/lam;
+   }
+
+   // the imaginary part of the numerator in terms of Clausen functions
+   const double lam = std::sqrt(4.*u*v - pow2(1. - u - v));
+   const double angles[4] = {
+      2.*std::acos((1. + u - v)/(2.*std::sqrt(u))),
+      2.*std::acos((1. - u + v)/(2.*std::sqrt(v))),
+      2.*std::acos((-1. + u + v)/(2.*std::sqrt(u*v))),
+      0.
+   };
+   const auto cl2 = clausen_2(SimdPack<4>::load(angles));
+
+   return 2.*(cl2[0] + cl2[1] + cl2[2])/lam;
+}
+
+/// function phi(x,y,z) from Davydychev and Tausk, Nucl. Phys. B397 (1993) 23
+double phi(double x, double y, double z)
+{
+   if (x <= z && y <= z)
+      return myphi(x, y, z);
+   if (z <= x && y <= x)
+      return z/x*myphi(z, y, x);
+   return z/y*myphi(z, x, y);
+}
+
+/// eq. (32) of DSZ
+double strF1ab(double t, double T1, double T2, double s2t, double c2t, double q)
+{
+   return -6*(1 - std::log(t/q)) + 5*std::log(T1*T2/pow2(t)) + pow2(std::log(T1*T2/pow2(t)))
+      + 8*pow2(std::log(t/q)) - 4*pow2(std::log(T1/q)) - 4*pow2(std::log(T2/q))
+      - pow2(c2t)*(2 - std::log(T1/q) - std::log(T2/q) - pow2(std::log(T1/T2)))
+      - pow2(s2t)*(T1/T2*(1 - std::log(T1/q)) + T2/T1*(1 - std::log(T2/q)));
+}
+
+/// eq. (A1) of DSZ
+double strF1c(double t, double mg, double T1, double s2t, double q)
+{
+   const double mt = std::sqrt(t);
+   const double g = pow2(mg);
+
+   const double del = pow2(g) + pow2(t) + pow2(T1) - 2*(g*t + g*T1 + t*T1);
+
+   return 4*(t + g - mg*mt*s2t)/T1*(1 - std::log(g/q))
+      + 4*std::log(t/g) - 2*std::log(T1/g)
+      + 2./del*(4*pow2(g)*std::log(T1/g)
+                + (pow2(g) - pow2(T1) + t*(10*g + 3*t + 2*t*g/T1 - 2*pow2(t)/T1))*std::log(t/g))
+      + 2*mg/mt*s2t*(pow2(std::log(T1/q)) + 2*std::log(t/q)*std::log(T1/q))
+      + 4*mg/mt*s2t/del*(g*(T1 - t - g)
+                         *std::log(T1/g) + t*(T1 - 3*g - 2*t - (t*g - pow2(t))/T1)*std::log(t/g))
+      + (4*g*(t + g - T1 - 2*mg*mt*s2t)/del
+         - 4*mg/mt*s2t)*phi(t, T1, g);
+}
+
+/// eq. (33) of DSZ
+double strF2ab(double T1, double T2, double s2t, double c2t, double q)
+{
+   return 5*std::log(T1/T2) - 3*(pow2(std::log(T1/q)) - pow2(std::log(T2/q)))
+      + pow2(c2t)*(5*std::log(T1/T2)
+                   - (T1 + T2)/(T1 - T2)*pow2(std::log(T1/T2))
+                   - 2/(T1 - T2)*(T1*std::log(T1/q) - T2*std::log(T2/q))*std::log(T1/T2))
+      + pow2(s2t)*(T1/T2*(1 - std::log(T1/q)) - T2/T1*(1 - std::log(T2/q)));
+}
+
+/// eq. (A2) of DSZ
+double strF2c(double t, double mg, double T1, double T2, double s2t, double q)
+{
+   const double mt = std::sqrt(t);
+   const double g = pow2(mg);
+
+   const double del = pow2(g) + pow2(t) + pow2(T1) - 2*(g*t + g*T1 + t*T1);
+
+   return 4*(t + g)/T1 - 4*mg/mt*s2t/(T1 - T2)*(3*T1 - t*T2/T1)
+      + 2*mg/mt*s2t/(T1 - T2)*(
+         (4*t + 5*T1 + T2)*std::log(T1/q) - 2*t*T2/T1*std::log(g/q))
+      - 4*(g + t)/T1*std::log(g/q) - 2*std::log(T1/g)
+      + 2/del*(2*g*(g + t - T1)*std::log(T1/g)
+               + 2*t*(3*g + 2*t - T1 + (g*t - pow2(t))/T1)*std::log(t/g))
+      - 4*mg*mt*s2t/del/T1*(2*g*T1*std::log(T1/g) -
+                            (pow2(t - T1) - g*(t + T1))*std::log(t/g))
+      - 8*mg*mt/s2t/(T1 - T2)*(std::log(T1/q) - std::log(t/q)*std::log(T1/q))
+      - mg/mt*s2t/(T1 - T2)*((T1 + T2)*pow2(std::log(T1/q))
+                             + (10*t - 2*g + T1 + T2)*std::log(t/q)*std::log(T1/q)
+                             + (2*g - 2*t + T1 + T2)*std::log(T1/q)*std::log(g/q))
+      + (8*g*t/del - 8*mg*mt/s2t/(T1 - T2)
+         + 2*s2t/mg/mt/(T1 - T2)*(4*g*t - del)
+         + s2t/mg/mt/del*pow2(T1 - g - t)*(T1 - g - t))*phi(t, T1, g);
+}
+
+/// eq. (34) of DSZ
+double strF3ab(double T1, double T2, double s2t, double c2t, double q)
+{
+   return (3 + 9*pow2(c2t))*(2 - (T1 + T2)/(T1 - T2)*std::log(T1/T2))
+      + 4 - (3 + 13*pow2(c2t))/(T1 - T2)*(T1*std::log(T1/q) - T2*std::log(T2/q))
+      + 3*(T1 + T2)/(T1 - T2)*(pow2(std::log(T1/q)) - pow2(std::log(T2/q)))
+      - pow2(c2t)*(4 - pow2((T1 + T2)/(T1 - T2))*pow2(std::log(T1/T2))
+                   - 6*(T1 + T2)/pow2(T1 - T2)
+                   *(T1*std::log(T1/q) - T2*std::log(T2/q))*std::log(T1/T2))
+      - pow2(s2t)*(T1/T2 + T2/T1 + 2*std::log(T1*T2/pow2(q))
+                   - pow2(T1)/T2/(T1 - T2)*std::log(T1/q)
+                   + pow2(T2)/T1/(T1 - T2)*std::log(T2/q));
+}
+
+/// eq. (A3) of DSZ
+double strF3c(double t, double mg, double T1, double T2, double s2t, double q)
+{
+   const double mt = std::sqrt(t);
+   const double g = pow2(mg);
+
+   const double del = pow2(g) + pow2(t) + pow2(T1) - 2*(g*t + g*T1 + t*T1);
+
+   return -4*T2/T1/(T1 - T2)*(g + t)
+      + 4*mg*mt*s2t/pow2(T1 - T2)*(21*T1 - pow2(T2)/T1)
+      + 4/(T1 - T2)*(g*T2/T1*std::log(g/q) - 2*(t + g)*std::log(T1/q))
+      - 24*mg*mt*s2t/pow2(T1 - T2)*(3*T1 + T2)*std::log(T1/q)
+      + 4*t/T1/del*(2*g*T1*std::log(T1/q) - g*(g - t + T1)*std::log(g/q) +
+                    (g*(t + T1) - pow2(t - T1))*std::log(t/q))
+      - 4*mg*mt*s2t/T1/del*(t*(g - t + T1)*std::log(t/q)
+                            - g*(g - t - T1)*std::log(g/q) + T1*(g + t - T1)*std::log(T1/q))
+      + 2*(2*g + 2*t - T1 - T2)/(T1 - T2)*std::log(g*t/pow2(q))*std::log(T1/q)
+      + 12*mg*mt*s2t/pow2(T1 - T2)*(2*(g - t)*std::log(g/t)*std::log(T1/q)
+                                    + (T1 + T2)*std::log(t*g/pow2(q))*std::log(T1/q))
+      + 8*mg*mt/s2t/pow2(T1 - T2)*
+      (-8*T1 + 2*(3*T1 + T2)*std::log(T1/q) - 2*(g - t)*std::log(g/t)*std::log(T1/q)
+       - (T1 + T2)*std::log(t*g/pow2(q))*std::log(T1/q))
+      - ((8/s2t - 12*s2t)*mt/mg/pow2(T1 - T2)
+         *(2*del + (g + t - T1)*(T1 - T2))
+         + (4*del + 8*g*t)/g/(T1 - T2) + 2*(g + t - T1)/g
+         - 4*t*(g + t - T1 - 2*mg*mt*s2t)/del)*phi(t, T1, g);
+}
+
+/// the functions F1, F2 and F3 of DSZ
+void strfuncs(double t, double mg, double T1, double T2, double s2t, double c2t, double q,
+              double& F1, double& F2, double& F3)
+{
+   F1 = strF1ab(t, T1, T2, s2t, c2t, q)
+      + strF1c(t, mg, T1, s2t, q)
+      + strF1c(t, mg, T2, -s2t, q);
+
+   F2 = strF2ab(T1, T2, s2t, c2t, q)
+      + strF2c(t, mg, T1, T2, s2t, q)
+      - strF2c(t, mg, T2, T1, -s2t, q);
+
+   F3 = strF3ab(T1, T2, s2t, c2t, q)
+      + strF3c(t, mg, T1, T2, s2t, q)
+      + strF3c(t, mg, T2, T1, -s2t, q);
+}
+
+/// shift to the Fi functions due to the renormalization of A, eqs. (35) and (36) of DSZ
+void strsfuncs(double mg, double T1, double T2, double q, double A, double& sF2, double& sF3)
+{
+   sF2 = mg/A*
+      2.*(pow2(std::log(T2/q)) - pow2(std::log(T1/q)));
+
+   sF3 = mg/A*
+      (8. - 2.*(T1 + T2)/(T1 - T2)*(pow2(std::log(T2/q)) - pow2(std::log(T1/q)))
+       + 8./(T1 - T2)*(T2*std::log(T2/q) - T1*std::log(T1/q)));
+}
+
+/// residues of some singular functions for s2t = 0 and for A = 0
+void strresfuncs(double t, double mg, double T1, double T2, double q,
+                 double& F2_s, double& sF2_A, double& sF3_A)
+{
+   const double mt = std::sqrt(t);
+   const double g = pow2(mg);
+
+   F2_s = -8*mg*mt/(T1 - T2)*(
+      (std::log(T1/q) - std::log(t/q)*std::log(T1/q) + phi(t, T1, g)) -
+      (std::log(T2/q) - std::log(t/q)*std::log(T2/q) + phi(t, T2, g)));
+
+   sF2_A = mg*
+      2.*(pow2(std::log(T2/q)) - pow2(std::log(T1/q)));
+
+   sF3_A = mg*
+      (8. - 2.*(T1 + T2)/(T1 - T2)*(pow2(std::log(T2/q)) - pow2(std::log(T1/q)))
+       + 8./(T1 - T2)*(T2*std::log(T2/q) - T1*std::log(T1/q)));
+}
+
+/// shift of the parameters from the DR to the on-shell scheme, eqs. (37)-(41) of DSZ
+void strdfuncs(double t, double mg, double T1, double T2, double s2t, double c2t, double q,
+               double At, double X,
+               double& DF1, double& DF2, double& DF3, double& DsF2, double& DsF3)
+{
+   const double msdr = -5.;
+   const double mt = std::sqrt(t);
+   const double g = pow2(mg);
+
+   const double F1o = std::log(T1/q) + std::log(T2/q) - 2.*std::log(t/q); // eq. (31)
+   const double F2o = std::log(T1/q) - std::log(T2/q);
+   const double F3o = 2. - (T1 + T2)/(T1 - T2)*(std::log(T1/q) - std::log(T2/q));
+
+   const double dmt = // eq. (B2)
+      mt*(3*std::log(t/q) + msdr + .5*(2*g/t*(std::log(g/q) - 1)
+                                       - T1/t*(std::log(T1/q) - 1) - T2/t*(std::log(T2/q) - 1)
+                                       + (g + t - T1 - 2*s2t*mg*mt)/t*myB0(t, g, T1, q)
+                                       + (g + t - T2 + 2*s2t*mg*mt)/t*myB0(t, g, T2, q)));
+
+   const double dm1 = // eq. (B3)
+      T1*(3*std::log(T1/q) - 7 - pow2(c2t)*(std::log(T1/q) - 1)
+          - pow2(s2t)*T2/T1*(std::log(T2/q) - 1) + 2*(
+             g/T1*(std::log(g/q) - 1) + t/T1*(std::log(t/q) - 1)
+             + (T1 - g - t + 2*s2t*mg*mt)/T1*myB0(T1, t, g, q)));
+
+   const double dm2 = // eq. (B4)
+      T2*(3*std::log(T2/q) - 7 - pow2(c2t)*(std::log(T2/q) - 1)
+          - pow2(s2t)*T1/T2*(std::log(T1/q) - 1) + 2*(
+             g/T2*(std::log(g/q) - 1) + t/T2*(std::log(t/q) - 1)
+             + (T2 - g - t - 2*s2t*mg*mt)/T2*myB0(T2, t, g, q)));
+
+   // on-shell theta-stop: asymmetric definition used in FeynHiggs
+   const double dth = (4.*mg*mt*c2t*myB0(T1, t, g, q) +
+                       c2t*s2t*(T2*(1. - std::log(T2/q)) - T1*(1. - std::log(T1/q))))/(T1 - T2);
+
+   const double ds2t = 2.*c2t*dth;
+
+   const double dAt = ((dm1 - dm2)/(T1 - T2) + ds2t/s2t - dmt/mt)*X; // eq. (B8)
+
+   DF1 = dm1/T1 + dm2/T2 - 4.*dmt/mt + 4.*dmt/mt*F1o; // eq. (37)
+   DF2 = dm1/T1 - dm2/T2 + (3.*dmt/mt + ds2t/s2t)*F2o; // eq. (38)
+   DF3 = (2.*T1*T2/pow2(T1 - T2)*std::log(T1/T2) - (T1 + T2)/(T1 - T2))
+      *(dm1/T1 - dm2/T2) + (2.*dmt/mt + 2.*ds2t/s2t)*F3o; // eq. (39)
+
+   DsF2 = dAt/At*F2o; // eq. (40)
+   DsF3 = dAt/At*F3o; // eq. (41)
+
+   // residues of some singular functions for s2t = 0 and for A = 0
+   if (s2t == 0.) {
+      DF2 = ds2t*F2o;
+      DsF2 = ds2t*X/At*F2o;
+   }
+
+   if (At == 0.) {
+      DsF2 = dAt*F2o;
+      DsF3 = dAt*F3o;
+   }
+}
+
+/// the kernel of dszhiggs, inlined into the loop over the points of a batch
+inline void dszhiggsKernel(double t, double mg, double T1, double T2, double st, double ct, double q,
+                           double mu, double tanb, double v2, double gs, int OS,
+                           double& S11, double& S22, double& S12) noexcept
+{
+   const double pi = 3.1415926535898;
+
+   const double mt = std::sqrt(t);
+
+   const double s2t = 2.*ct*st;
+   const double c2t = pow2(ct) - pow2(st);
+
+   const double X = (T1 - T2)*s2t/2./mt; // eq. (19) of DSZ
+   const double A = X - mu/tanb;         // notice the sign convention for mu
+
+   const double sb = std::sin(std::atan(tanb));
+   const double ht = std::sqrt(2./v2)*mt/sb;
+
+   const double k = 4.*pow2(gs)/pow2(16.*pow2(pi)); // gs^2/(16 Pi^2)^2 CF Nc
+
+   double F1, F2, F3, sF2, sF3, DF1, DF2, DF3, DsF2, DsF3;
+   strfuncs(t, mg, T1, T2, s2t, c2t, q, F1, F2, F3);
+   strsfuncs(mg, T1, T2, q, A, sF2, sF3);
+   strdfuncs(t, mg, T1, T2, s2t, c2t, q, A, X, DF1, DF2, DF3, DsF2, DsF3);
+
+   const double osdr = 1.*OS;
+
+   S11 = S12 = S22 = 0.;
+
+   if (s2t != 0. && A != 0.) {
+      S11 = .5*pow2(ht)*pow2(mu)*pow2(s2t)*(F3 + osdr*DF3); // eq. (25)
+
+      S12 = .5*pow2(ht)*mu*A*pow2(s2t)*(F3 + sF3 + // eq. (26)
+                                         osdr*(DF3 + DsF3)) +
+         pow2(ht)*mt*mu*s2t*(F2 + osdr*DF2);
+
+      S22 = .5*pow2(ht)*pow2(A)*pow2(s2t)*(F3 + 2.*sF3 + // eq. (27)
+                                            osdr*(DF3 + 2.*DsF3)) +
+         2.*pow2(ht)*mt*A*s2t*(F2 + sF2 +
+                               osdr*(DF2 + DsF2)) +
+         2.*pow2(ht)*pow2(mt)*(F1 + osdr*DF1);
+   } else if (s2t == 0. && A == 0.) {
+      // some of the functions have poles in s2t = 0 or in A = 0,
+      // when necessary we consider the residues
+      S11 = 0.;
+      S12 = 0.;
+      S22 = 2*pow2(ht)*pow2(mt)*(F1 + osdr*DF1);
+   } else if (s2t == 0. && A != 0.) {
+      double F2_s, sF2_A, sF3_A;
+      strresfuncs(t, mg, T1, T2, q, F2_s, sF2_A, sF3_A);
+
+      S11 = 0.;
+      S12 = pow2(ht)*mt*mu*(F2_s + osdr*DF2);
+      S22 = 2.*pow2(ht)*pow2(mt)*(F1 + osdr*DF1) +
+         2.*pow2(ht)*mt*A*(F2_s + osdr*DF2);
+   } else if (s2t != 0. && A == 0.) {
+      double F2_s, sF2_A, sF3_A;
+      strresfuncs(t, mg, T1, T2, q, F2_s, sF2_A, sF3_A);
+
+      S11 = .5*pow2(ht)*pow2(mu)*pow2(s2t)*(F3 + osdr*DF3);
+      S12 = .5*pow2(ht)*mu*pow2(s2t)*(sF3_A + osdr*DsF3) +
+         pow2(ht)*mt*mu*s2t*(F2 + osdr*DF2);
+      S22 = 2.*pow2(ht)*pow2(mt)*(F1 + osdr*DF1) +
+         2.*pow2(ht)*mt*s2t*(sF2_A + osdr*DsF2);
+   }
+
+   S11 = k*S11;
+   S12 = k*S12;
+   S22 = k*S22;
+}
+
+} // anonymous namespace
+
+void dszhiggs(double t, double mg, double T1, double T2, double st, double ct, double q,
+              double mu, double tanb, double v2, double gs, int OS,
+              double& S11, double& S22, double& S12) noexcept
+{
+   dszhiggsKernel(t, mg, T1, T2, st, ct, q, mu, tanb, v2, gs, OS, S11, S22, S12);
+}
+
+DSZResultBatch dszhiggs(const DSZBatch& points, int OS)
+{
+   const std::size_t n = points.t.size();
+
+   DSZResultBatch results;
+   results.S11.resize(n);
+   results.S22.resize(n);
+   results.S12.resize(n);
+
+   for (std::size_t i = 0; i < n; i++) {
+      dszhiggsKernel(points.t[i], points.mg[i], points.T1[i], points.T2[i],
+                     points.st[i], points.ct[i], points.q[i], points.mu[i],
+                     points.tanb[i], points.v2[i], points.gs[i], OS,
+                     results.S11[i], results.S22[i], results.S12[i]);
+   }
+
+   return results;
+}
+
+} // namespace mh2l
+} // namespace himalaya
@@ -0,0 +1,44 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+#include "Linalg.hpp"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * 	Calculates the lowest eigenvalue of a real symmetric 2x2 matrix in closed form.
+ * 	@param matrix the real symmetric matrix, only the upper triangle is used.
+ * 	@return The lowest eigenvalue.
+ */
+double himalaya::calcLowestEigenvalue(const Eigen::Matrix2d& matrix) noexcept
+{
+   // eigenvalues (a + c)/2 -/+ sqrt(((a - c)/2)^2 + b^2) of the matrix ((a, b), (b, c))
+   const double mean = 0.5 * (matrix(0,0) + matrix(1,1));
+   const double diff = 0.5 * (matrix(0,0) - matrix(1,1));
+   const double offd = matrix(0,1);
+   const double det = matrix(0,0) * matrix(1,1) - offd * offd;
+
+   // The eigenvalue of larger magnitude is free of cancellations, the
+   // other one follows from the product of the eigenvalues.
+   const double h = mean + std::copysign(std::sqrt(diff * diff + offd * offd), mean);
+
+   return h == 0. ? 0. : std::min(h, det / h);
+}
+
+/**
+ * 	Calculates the lowest eigenvalues of many real symmetric 2x2 matrices in closed form.
+ * 	@param matrices pointer to the real symmetric matrices, only the upper triangles are used.
+ * 	@param n the number of matrices.
+ * 	@param eigenvalues pointer to the n lowest eigenvalues, which are calculated.
+ */
+void himalaya::calcLowestEigenvalues(const Eigen::Matrix2d* matrices, std::size_t n, double* eigenvalues) noexcept
+{
+   // branch-free loop, which can be vectorized by the compiler
+   for (std::size_t i = 0; i < n; i++) {
+      eigenvalues[i] = calcLowestEigenvalue(matrices[i]);
+   }
+}
@@ -0,0 +1,36 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+#include "Polylog.hpp"
+#include <algorithm>
+
+namespace himalaya {
+
+namespace {
+
+/// applies f to packs of SIMD_WIDTH arguments, the last pack may be incomplete
+template <typename F>
+void applyPacked(const double* x, std::size_t n, double* result, F f) noexcept {
+   typedef SimdPack<SIMD_WIDTH> Pack;
+
+   for (std::size_t i = 0; i < n; i += SIMD_WIDTH) {
+      const int m = static_cast<int>(std::min<std::size_t>(n - i, SIMD_WIDTH));
+      f(Pack::load(x + i, m)).store(result + i, m);
+   }
+}
+
+} // anonymous namespace
+
+void dilog(const double* x, std::size_t n, double* li2) noexcept {
+   applyPacked(x, n, li2, [] (const SimdPack<SIMD_WIDTH>& p) { return dilog(p); });
+}
+
+void clausen_2(const double* x, std::size_t n, double* cl2) noexcept {
+   applyPacked(x, n, cl2, [] (const SimdPack<SIMD_WIDTH>& p) { return clausen_2(p); });
+}
+
+} // namespace himalaya
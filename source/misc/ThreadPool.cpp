@@ -0,0 +1,171 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+#include "ThreadPool.hpp"
+#include <algorithm>
+
+/**
+ * 	Starts the worker threads.
+ * 	@param numberOfWorkers the number of worker threads. If 0, the number of hardware threads is used.
+ */
+himalaya::ThreadPool::ThreadPool(unsigned int numberOfWorkers)
+{
+   if (numberOfWorkers == 0) {
+      numberOfWorkers = std::max(1u, std::thread::hardware_concurrency());
+   }
+
+   for (unsigned int i = 0; i < numberOfWorkers; i++) {
+      queues.emplace_back(new WorkQueue);
+   }
+
+   for (unsigned int i = 0; i < numberOfWorkers; i++) {
+      workers.emplace_back(&ThreadPool::work, this, i);
+   }
+}
+
+/**
+ * 	Stops and joins the worker threads.
+ */
+himalaya::ThreadPool::~ThreadPool()
+{
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      stop = true;
+   }
+   startCondition.notify_all();
+
+   for (auto& worker: workers) {
+      worker.join();
+   }
+}
+
+/**
+ * 	@return The number of worker threads.
+ */
+unsigned int himalaya::ThreadPool::getNumberOfWorkers() const
+{
+   return workers.size();
+}
+
+/**
+ * 	Calls task(i) for all i in [0, numberOfTasks) on the worker threads and waits until all tasks are done.
+ * 	Concurrent calls of this function are processed one after the other.
+ * 	@param numberOfTasks the number of tasks.
+ * 	@param task the task, which must be safe to be called concurrently.
+ * 	@throws The first exception thrown by a task, after all remaining tasks are done.
+ */
+void himalaya::ThreadPool::run(std::size_t numberOfTasks, const Task& task)
+{
+   if (numberOfTasks == 0) {
+      return;
+   }
+
+   // only one batch is processed at a time
+   std::lock_guard<std::mutex> runLock(runMutex);
+   std::unique_lock<std::mutex> lock(mutex);
+
+   // distribute contiguous blocks of tasks over the workers
+   const std::size_t numberOfWorkers = queues.size();
+   for (std::size_t i = 0; i < numberOfWorkers; i++) {
+      std::lock_guard<std::mutex> queueLock(queues[i]->mutex);
+      for (std::size_t t = i * numberOfTasks / numberOfWorkers;
+           t < (i + 1) * numberOfTasks / numberOfWorkers; t++) {
+         queues[i]->tasks.push_back(t);
+      }
+   }
+
+   currentTask = &task;
+   exception = nullptr;
+   busyWorkers = numberOfWorkers;
+   batch++;
+
+   startCondition.notify_all();
+   doneCondition.wait(lock, [this] { return busyWorkers == 0; });
+
+   currentTask = nullptr;
+
+   if (exception) {
+      std::rethrow_exception(exception);
+   }
+}
+
+/**
+ * 	The loop executed by each worker thread.
+ * 	@param worker the index of the worker.
+ */
+void himalaya::ThreadPool::work(unsigned int worker)
+{
+   unsigned long lastBatch = 0;
+
+   while (true) {
+      const Task* task = nullptr;
+
+      {
+         std::unique_lock<std::mutex> lock(mutex);
+         startCondition.wait(lock, [this, lastBatch] { return stop || batch != lastBatch; });
+         if (stop) {
+            return;
+         }
+         lastBatch = batch;
+         task = currentTask;
+      }
+
+      std::size_t index;
+      while (takeTask(worker, index)) {
+         try {
+            (*task)(index);
+         } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!exception) {
+               exception = std::current_exception();
+            }
+         }
+      }
+
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         busyWorkers--;
+         if (busyWorkers == 0) {
+            doneCondition.notify_one();
+         }
+      }
+   }
+}
+
+/**
+ * 	Takes a task index from the queue of the given worker or steals one from another worker.
+ * 	@param worker the index of the worker.
+ * 	@param index the taken task index.
+ * 	@return False if there are no tasks left, true otherwise.
+ */
+bool himalaya::ThreadPool::takeTask(unsigned int worker, std::size_t& index)
+{
+   // take the next task of the own queue
+   {
+      WorkQueue& queue = *queues[worker];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (!queue.tasks.empty()) {
+         index = queue.tasks.front();
+         queue.tasks.pop_front();
+         return true;
+      }
+   }
+
+   // steal the last task of another queue
+   const std::size_t numberOfWorkers = queues.size();
+   for (std::size_t i = 1; i < numberOfWorkers; i++) {
+      WorkQueue& queue = *queues[(worker + i) % numberOfWorkers];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (!queue.tasks.empty()) {
+         index = queue.tasks.back();
+         queue.tasks.pop_back();
+         return true;
+      }
+   }
+
+   return false;
+}
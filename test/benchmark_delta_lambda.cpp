@@ -0,0 +1,105 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+// Compares the run time of calculateDLambda3L with the one of
+// calculateDMh3L for parameter points with different hierarchies.
+
+#include "HierarchyCalculator.hpp"
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+himalaya::Parameters make_point(double MS, double xt, double mg)
+{
+   const double tb = 10.;
+   const double beta = std::atan(tb);
+   const double MS2 = MS*MS;
+
+   himalaya::Parameters pars;
+   pars.scale = MS;
+   pars.mu = MS;
+   pars.g1 = 0.46;
+   pars.g2 = 0.65;
+   pars.g3 = 1.10073;
+   pars.vd = 246*std::cos(beta);
+   pars.vu = 246*std::sin(beta);
+   pars.mq2 << MS2, 0, 0, 0, MS2, 0, 0, 0, MS2;
+   pars.md2 << MS2, 0, 0, 0, MS2, 0, 0, 0, MS2;
+   pars.mu2 << MS2, 0, 0, 0, MS2, 0, 0, 0, 0.7*MS2;
+   pars.ml2 << MS2, 0, 0, 0, MS2, 0, 0, 0, MS2;
+   pars.me2 << MS2, 0, 0, 0, MS2, 0, 0, 0, MS2;
+   pars.Au << 0, 0, 0, 0, 0, 0, 0, 0, xt*MS + pars.mu/tb;
+   pars.Ad << 0, 0, 0, 0, 0, 0, 0, 0, 0;
+   pars.Ae << 0, 0, 0, 0, 0, 0, 0, 0, 0;
+   pars.MA = MS;
+   pars.M1 = MS;
+   pars.M2 = MS;
+   pars.MG = mg*MS;
+   pars.Mt = 154.682;
+   pars.Mb = 2.50901;
+   pars.Mtau = 1.777;
+
+   return pars;
+}
+
+/// returns the run time of f in seconds
+double time_it(const std::function<void()>& f)
+{
+   const auto start = std::chrono::steady_clock::now();
+   f();
+   const auto stop = std::chrono::steady_clock::now();
+   return std::chrono::duration<double>(stop - start).count();
+}
+
+} // anonymous namespace
+
+int main()
+{
+   std::vector<himalaya::HierarchyCalculator> calculators;
+   for (const double MS: {1000., 2000., 5000.}) {
+      for (const double xt: {-2., 0.5, 2.}) {
+         for (const double mg: {0.5, 1., 2.}) {
+            calculators.emplace_back(make_point(MS, xt, mg), false);
+         }
+      }
+   }
+
+   const int repetitions = 5;
+   double sum = 0.;
+
+   const double all = time_it([&] {
+      for (int i = 0; i < repetitions; i++)
+         for (const auto& hc: calculators)
+            sum += hc.calculateDMh3L(false).getDLambda(3);
+   });
+
+   const double dlambda = time_it([&] {
+      for (int i = 0; i < repetitions; i++)
+         for (const auto& hc: calculators)
+            sum += hc.calculateDMh3L(false, himalaya::ResultFields::DLAMBDA).getDLambda(3);
+   });
+
+   const double fast = time_it([&] {
+      for (int i = 0; i < repetitions; i++)
+         for (const auto& hc: calculators)
+            sum += hc.calculateDLambda3L().dLambda;
+   });
+
+   const int n = repetitions*calculators.size();
+
+   std::cout << "time per point:\n"
+             << "calculateDMh3L(false)          = " << all/n*1e3 << " ms\n"
+             << "calculateDMh3L(false, DLAMBDA) = " << dlambda/n*1e3 << " ms (speedup " << all/dlambda << ")\n"
+             << "calculateDLambda3L()           = " << fast/n*1e3 << " ms (speedup " << all/fast << ")\n"
+             << "checksum                       = " << sum << '\n';
+
+   return 0;
+}
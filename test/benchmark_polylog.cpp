@@ -0,0 +1,87 @@
+// ====================================================================
+// This file is part of Himalaya.
+//
+// Himalaya is licenced under the GNU General Public License (GNU GPL)
+// version 3.
+// ====================================================================
+
+// Compares the run time of the dilogarithm and the Clausen function of
+// Polylog.hpp, for single arguments and for arrays of arguments, with
+// the ones of GM2Calc.
+
+#include "Polylog.hpp"
+#include "dilog.h"
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+/// returns the run time of f in seconds
+double time_it(const std::function<void()>& f)
+{
+   const auto start = std::chrono::steady_clock::now();
+   f();
+   const auto stop = std::chrono::steady_clock::now();
+   return std::chrono::duration<double>(stop - start).count();
+}
+
+} // anonymous namespace
+
+int main()
+{
+   const std::size_t n = 1000000;
+   std::vector<double> x(n), result(n);
+   // pseudo-random arguments in [-10, 10], such that the branches of the scalar routines are not predictable
+   unsigned long long seed = 1;
+   for (std::size_t i = 0; i < n; i++) {
+      seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+      x[i] = -10. + 20.*static_cast<double>(seed >> 11)/9007199254740992.;
+   }
+
+   double sum = 0.;
+
+   const double dilog_gm2calc = time_it([&] {
+      for (std::size_t i = 0; i < n; i++)
+         sum += gm2calc::dilog(x[i]);
+   });
+
+   const double dilog_scalar = time_it([&] {
+      for (std::size_t i = 0; i < n; i++)
+         sum += himalaya::dilog(x[i]);
+   });
+
+   const double dilog_batch = time_it([&] {
+      himalaya::dilog(x.data(), n, result.data());
+      for (std::size_t i = 0; i < n; i++)
+         sum += result[i];
+   });
+
+   const double clausen_gm2calc = time_it([&] {
+      for (std::size_t i = 0; i < n; i++)
+         sum += gm2calc::clausen_2(x[i]);
+   });
+
+   const double clausen_scalar = time_it([&] {
+      for (std::size_t i = 0; i < n; i++)
+         sum += himalaya::clausen_2(x[i]);
+   });
+
+   const double clausen_batch = time_it([&] {
+      himalaya::clausen_2(x.data(), n, result.data());
+      for (std::size_t i = 0; i < n; i++)
+         sum += result[i];
+   });
+
+   std::cout << "time per argument:\n"
+             << "gm2calc::dilog       = " << dilog_gm2calc/n*1e9 << " ns\n"
+             << "dilog(double)        = " << dilog_scalar/n*1e9 << " ns (speedup " << dilog_gm2calc/dilog_scalar << ")\n"
+             << "dilog(array)         = " << dilog_batch/n*1e9 << " ns (speedup " << dilog_gm2calc/dilog_batch << ")\n"
+             << "gm2calc::clausen_2   = " << clausen_gm2calc/n*1e9 << " ns\n"
+             << "clausen_2(double)    = " << clausen_scalar/n*1e9 << " ns (speedup " << clausen_gm2calc/clausen_scalar << ")\n"
+             << "clausen_2(array)     = " << clausen_batch/n*1e9 << " ns (speedup " << clausen_gm2calc/clausen_batch << ")\n"
+             << "checksum             = " << sum << '\n';
+
+   return 0;
+}
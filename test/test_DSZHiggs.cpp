@@ -0,0 +1,116 @@
+#include "doctest.h"
+#include "DSZHiggs.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+extern "C" void dszhiggs_(double *t, double *mg, double *T1, double *T2, double *st, double *ct, double *q, double *mu, double *tanb,
+      double *v2, double *gs, int *OS, double *S11, double *S22, double *S12);
+
+namespace {
+
+double pow2(double x) { return x*x; }
+
+/// samples the input parameters of dszhiggs, including the points with s2t = 0 and/or A = 0
+himalaya::mh2l::DSZBatch make_points()
+{
+   himalaya::mh2l::DSZBatch points;
+
+   const auto add = [&points] (double mt, double mg, double mst1, double mst2, double theta,
+                               double scale, double mu, double tanb) {
+      points.t.push_back(pow2(mt));
+      points.mg.push_back(mg);
+      points.T1.push_back(pow2(mst1));
+      points.T2.push_back(pow2(mst2));
+      points.st.push_back(std::sin(theta));
+      points.ct.push_back(std::cos(theta));
+      points.q.push_back(pow2(scale));
+      points.mu.push_back(mu);
+      points.tanb.push_back(tanb);
+      points.v2.push_back(pow2(246.));
+      points.gs.push_back(1.1);
+   };
+
+   for (const double mst1: {300., 1000., 2500.}) {
+      for (const double r: {1.1, 2., 5.}) {
+         for (const double mg: {200., 1500., 6000.}) {
+            for (const double theta: {-0.7, -0.1, 0.3, 0.785}) {
+               for (const double tanb: {3., 20.}) {
+                  const double mst2 = r*mst1;
+                  add(173.3, mg, mst1, mst2, theta, mst1, 0.8*mst2, tanb);
+               }
+            }
+         }
+      }
+   }
+
+   // s2t = 0
+   add(173.3, 1500., 1000., 1300., 0., 900., 700., 10.);
+   // s2t = 0 and A = 0
+   add(173.3, 1500., 1000., 1300., 0., 900., 0., 10.);
+   // A = 0
+   {
+      const double mt = 160., mst1 = 800., mst2 = 1200., theta = 0.4, tanb = 8.;
+      const double X = (pow2(mst1) - pow2(mst2))*std::sin(2*theta)/2./mt;
+      add(mt, 1000., mst1, mst2, theta, 1000., X*tanb, tanb);
+   }
+   // stop mass below the top mass
+   add(173.3, 2000., 120., 900., 0.2, 173.3, 500., 5.);
+
+   return points;
+}
+
+} // anonymous namespace
+
+TEST_CASE("test_native_dszhiggs")
+{
+   const auto points = make_points();
+   const std::size_t n = points.t.size();
+   auto p = points; // dszhiggs_ takes non-const pointers
+
+   for (const int OS: {0, 1}) {
+      for (std::size_t i = 0; i < n; i++) {
+         int os = OS;
+         double S11, S22, S12;
+         dszhiggs_(&p.t[i], &p.mg[i], &p.T1[i], &p.T2[i], &p.st[i], &p.ct[i], &p.q[i], &p.mu[i],
+                   &p.tanb[i], &p.v2[i], &p.gs[i], &os, &S11, &S22, &S12);
+
+         double s11, s22, s12;
+         himalaya::mh2l::dszhiggs(points.t[i], points.mg[i], points.T1[i], points.T2[i],
+                                  points.st[i], points.ct[i], points.q[i], points.mu[i],
+                                  points.tanb[i], points.v2[i], points.gs[i], OS, s11, s22, s12);
+
+         // relative to the size of the matrix, because single elements may cancel
+         const double norm = std::max({std::abs(S11), std::abs(S22), std::abs(S12)});
+         INFO("point " << i << ", OS = " << OS);
+         CHECK(std::abs(s11 - S11) <= 1e-12*norm);
+         CHECK(std::abs(s22 - S22) <= 1e-12*norm);
+         CHECK(std::abs(s12 - S12) <= 1e-12*norm);
+      }
+   }
+}
+
+TEST_CASE("test_native_dszhiggs_batch")
+{
+   const auto points = make_points();
+   const std::size_t n = points.t.size();
+
+   for (const int OS: {0, 1}) {
+      const auto results = himalaya::mh2l::dszhiggs(points, OS);
+
+      REQUIRE(results.S11.size() == n);
+      REQUIRE(results.S22.size() == n);
+      REQUIRE(results.S12.size() == n);
+
+      for (std::size_t i = 0; i < n; i++) {
+         double s11, s22, s12;
+         himalaya::mh2l::dszhiggs(points.t[i], points.mg[i], points.T1[i], points.T2[i],
+                                  points.st[i], points.ct[i], points.q[i], points.mu[i],
+                                  points.tanb[i], points.v2[i], points.gs[i], OS, s11, s22, s12);
+
+         CHECK(results.S11[i] == s11);
+         CHECK(results.S22[i] == s22);
+         CHECK(results.S12[i] == s12);
+      }
+   }
+}
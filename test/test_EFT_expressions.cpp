@@ -214,3 +214,148 @@ TEST_CASE("test_EFT_expressions")
    
     _test_EFT_expressions(p, msq * msq);
 }
+
+TEST_CASE("test_shared_threshold_calculator")
+{
+   const himalaya::Parameters p = test_point();
+   const double msq = 533.204;
+
+   himalaya::mh2_eft::Mh2EFTCalculator mhc(p, msq * msq);
+   himalaya::ThresholdCalculator& tc = mhc.getThresholdCalculator();
+
+   // all loop orders use the same ThresholdCalculator
+   CHECK(&mhc.getThresholdCalculator() == &tc);
+   const double delta_mh_1l = mhc.getDeltaMh2EFT1Loop(1, 1);
+   const double delta_mh_2l = mhc.getDeltaMh2EFT2Loop(1, 1);
+   const double delta_mh_3l = mhc.getDeltaMh2EFT3Loop(1, 1);
+   CHECK(&mhc.getThresholdCalculator() == &tc);
+
+   // the results are the same as with a new calculator for each loop order
+   CHECK(himalaya::mh2_eft::Mh2EFTCalculator(p, msq * msq).getDeltaMh2EFT1Loop(1, 1) == delta_mh_1l);
+   CHECK(himalaya::mh2_eft::Mh2EFTCalculator(p, msq * msq).getDeltaMh2EFT2Loop(1, 1) == delta_mh_2l);
+   CHECK(himalaya::mh2_eft::Mh2EFTCalculator(p, msq * msq).getDeltaMh2EFT3Loop(1, 1) == delta_mh_3l);
+
+   himalaya::ThresholdCalculator tc_new(p, msq * msq);
+   CHECK(tc.getLimit() == tc_new.getLimit());
+   CHECK(tc.getThresholdCorrection(himalaya::ThresholdVariables::LAMBDA_AT_AS2, himalaya::RenSchemes::DRBARPRIME, 1)
+         == tc_new.getThresholdCorrection(himalaya::ThresholdVariables::LAMBDA_AT_AS2, himalaya::RenSchemes::DRBARPRIME, 1));
+}
+
+TEST_CASE("test_lazy_mass_limit")
+{
+   himalaya::Parameters p = test_point();
+   const double msq = 533.204;
+
+   // nearly degenerate stop and gluino masses
+   p.mu2(2,2) = p.mq2(2,2)*1.0001;
+   p.MG = std::sqrt(p.mq2(2,2))*1.001;
+
+   himalaya::ThresholdCalculator tc(p, msq * msq);
+
+   // limit independent threshold corrections do not determine the limit
+   const double g3as = tc.getThresholdCorrection(himalaya::ThresholdVariables::G3_AS,
+      himalaya::RenSchemes::DRBARPRIME, 1);
+   CHECK(!tc.limitDetermined);
+
+   const double lambda = tc.getThresholdCorrection(himalaya::ThresholdVariables::LAMBDA_AT_AS2,
+      himalaya::RenSchemes::DRBARPRIME, 1);
+   CHECK(tc.limitDetermined);
+   const int limit = tc.getLimit();
+
+   // a precomputed limit skips the determination
+   himalaya::ThresholdCalculator tc_set(p, msq * msq);
+   tc_set.setLimit(limit);
+   CHECK(tc_set.limitDetermined);
+   CHECK(tc_set.getThresholdCorrection(himalaya::ThresholdVariables::G3_AS,
+      himalaya::RenSchemes::DRBARPRIME, 1) == g3as);
+   CHECK(tc_set.getThresholdCorrection(himalaya::ThresholdVariables::LAMBDA_AT_AS2,
+      himalaya::RenSchemes::DRBARPRIME, 1) == lambda);
+   CHECK(tc_set.getDRbarPrimeToMSbarShift(3, 1) == tc.getDRbarPrimeToMSbarShift(3, 1));
+}
+
+TEST_CASE("test_threshold_corrections_sweep")
+{
+   const himalaya::Parameters p = test_point();
+   const double msq = 533.204;
+
+   himalaya::ThresholdCalculator tc(p, msq * msq);
+
+   for (const int scheme: {himalaya::RenSchemes::DRBARPRIME, himalaya::RenSchemes::TEST}) {
+      for (const int omitLogs: {0, 1}) {
+         const himalaya::ThresholdCorrections corrections = tc.getThresholdCorrections(scheme, omitLogs);
+
+         for (int variable = himalaya::ThresholdVariables::FIRST;
+              variable < himalaya::ThresholdVariables::NUMBER_OF_THRESHOLD_VARIALES; variable++) {
+            INFO("Checking variable " << variable << " in scheme " << scheme << " with omitLogs = " << omitLogs);
+            CHECK(corrections[variable] == tc.getThresholdCorrection(variable, scheme, omitLogs));
+         }
+      }
+   }
+}
+
+TEST_CASE("test_disabled_orders")
+{
+   const himalaya::Parameters p = test_point();
+   const double msq = 533.204;
+
+   // no threshold correction is calculated if all orders are disabled
+   himalaya::mh2_eft::Mh2EFTCalculator mhc(p, msq * msq);
+   for (int order = himalaya::EFTOrders::FIRST; order < himalaya::EFTOrders::NUMBER_OF_EFT_ORDERS; order++) {
+      mhc.setCorrectionFlag(order, 0);
+   }
+   CHECK(mhc.getDeltaMh2EFT1Loop(1, 1) == 0.);
+   CHECK(mhc.getDeltaMh2EFT2Loop(1, 1) == 0.);
+   CHECK(mhc.thresholdCorrectionsMap[1].calculated == 0);
+
+   // only the threshold corrections of enabled orders are calculated
+   mhc.setCorrectionFlag(himalaya::EFTOrders::G32YT4, 1);
+   const double delta_mh_2l = mhc.getDeltaMh2EFT2Loop(1, 1);
+   CHECK(mhc.thresholdCorrectionsMap[1].calculated
+         == (1ull << himalaya::ThresholdVariables::YT_AS | 1ull << himalaya::ThresholdVariables::LAMBDA_AT_AS));
+
+   // the sum of all orders is the result with all orders enabled
+   for (const int loops: {1, 2}) {
+      double sum = 0.;
+      for (int order = himalaya::EFTOrders::FIRST; order < himalaya::EFTOrders::NUMBER_OF_EFT_ORDERS; order++) {
+         himalaya::mh2_eft::Mh2EFTCalculator mhc_order(p, msq * msq);
+         for (int other = himalaya::EFTOrders::FIRST; other < himalaya::EFTOrders::NUMBER_OF_EFT_ORDERS; other++) {
+            mhc_order.setCorrectionFlag(other, other == order);
+         }
+         sum += loops == 1 ? mhc_order.getDeltaMh2EFT1Loop(1, 1) : mhc_order.getDeltaMh2EFT2Loop(1, 1);
+         if (loops == 2 && order == himalaya::EFTOrders::G32YT4) {
+            CHECK(mhc_order.getDeltaMh2EFT2Loop(1, 1) == delta_mh_2l);
+         }
+      }
+      himalaya::mh2_eft::Mh2EFTCalculator mhc_copy(p, msq * msq);
+      const double all = loops == 1 ? mhc_copy.getDeltaMh2EFT1Loop(1, 1) : mhc_copy.getDeltaMh2EFT2Loop(1, 1);
+      CHECK_CLOSE(sum, all, 1e-10);
+   }
+
+   CHECK_THROWS_AS(mhc.setCorrectionFlag(himalaya::EFTOrders::NUMBER_OF_EFT_ORDERS, 1), std::out_of_range);
+}
+
+TEST_CASE("test_shift_Xt_polynomial")
+{
+   const himalaya::Parameters p = test_point();
+   const double msq = 533.204;
+
+   himalaya::ThresholdCalculator tc(p, msq * msq);
+   const int limit = tc.getLimit();
+   const double MS = std::sqrt(std::sqrt(p.mq2(2,2) * p.mu2(2,2)));
+
+   for (const int xtOrder: {3, 4}) {
+      for (const int omitXtLogs: {0, 1}) {
+         const himalaya::XtPolynomial shift = tc.getDRbarPrimeToMSbarShiftXtPolynomial(xtOrder, 1, omitXtLogs);
+
+         for (const double xt: {-2.5, -1., 0., 0.7, 2.}) {
+            const double Xt = xt * MS;
+            INFO("Checking Xt = " << Xt << " at xtOrder = " << xtOrder << " with omitXtLogs = " << omitXtLogs);
+            himalaya::Parameters q = p;
+            q.Au(2,2) = Xt + q.mu * q.vd / q.vu;
+            himalaya::ThresholdCalculator tcq(q, msq * msq);
+            tcq.setLimit(limit);
+            CHECK_CLOSE(shift.eval(Xt), tcq.getDRbarPrimeToMSbarShift(xtOrder, 1, omitXtLogs), 1e-8);
+         }
+      }
+   }
+}
@@ -2,7 +2,16 @@
 #define private public
 #include "HierarchyCalculator.hpp"
 #undef private
+#include "BatchEvaluation.hpp"
 #include "Hierarchies.hpp"
+#include "H3.hpp"
+#include "H6b.hpp"
+#include "Linalg.hpp"
+#include "SimdPack.hpp"
+#include "ThresholdCalculator.hpp"
+#include <algorithm>
+#include <sstream>
+#include <vector>
 
 #define CHECK_CLOSE(a,b,eps) CHECK((a) == doctest::Approx(b).epsilon(eps))
 
@@ -274,3 +283,619 @@ TEST_CASE("test_FO_expansions")
       }
    }
 }
+
+
+/// returns the root of the lowest eigenvalue, NaN roots are sorted as by std::sort
+double calcLowestMass(const Eigen::EigenSolver<Eigen::Matrix2d>& es)
+{
+   std::vector<double> masses = {std::sqrt(std::real(es.eigenvalues()(0))), std::sqrt(std::real(es.eigenvalues()(1)))};
+   std::sort(masses.begin(), masses.end());
+   return masses.at(0);
+}
+
+/**
+ * Compares the estimated uncertainty of the expansion to the one
+ * obtained by truncating the expansion in each expansion variable one
+ * after another and re-evaluating the whole expansion.
+ */
+TEST_CASE("test_expansion_uncertainty")
+{
+   using namespace himalaya;
+
+   // expansion variables which are truncated for each mother hierarchy
+   const std::map<int, std::vector<ExpansionDepth::ExpansionDepth>> truncatedVariables = {
+      { Hierarchies::h3 , { ExpansionDepth::xxDmglst1, ExpansionDepth::xxDmsqst1, ExpansionDepth::xxDmst12 } },
+      { Hierarchies::h4 , { ExpansionDepth::xxAt, ExpansionDepth::xxlmMsusy, ExpansionDepth::xxMsq, ExpansionDepth::xxMsusy } },
+      { Hierarchies::h5 , { ExpansionDepth::xxDmglst1, ExpansionDepth::xxMsq } },
+      { Hierarchies::h6 , { ExpansionDepth::xxDmglst2, ExpansionDepth::xxMsq } },
+      { Hierarchies::h6b, { ExpansionDepth::xxDmglst2, ExpansionDepth::xxDmsqst2 } },
+      { Hierarchies::h9 , { ExpansionDepth::xxDmsqst1, ExpansionDepth::xxDmst12, ExpansionDepth::xxMgl } }
+   };
+
+   const auto pars = make_point();
+   const double tbeta = pars.vu/pars.vd;
+   const double s2b = std::sin(2*std::atan(tbeta));
+
+   Eigen::Matrix2d treelvl;
+   treelvl(0,0) = s2b/2.*(pars.MZ*pars.MZ / tbeta + pars.MA*pars.MA * tbeta);
+   treelvl(1,0) = s2b/2.*(-pars.MZ*pars.MZ - pars.MA*pars.MA);
+   treelvl(0,1) = treelvl(1,0);
+   treelvl(1,1) = s2b/2.*(pars.MZ*pars.MZ * tbeta + pars.MA*pars.MA / tbeta);
+
+   for (int i = 0; i < Hierarchies::NUMBER_OF_HIERARCHIES; i++) {
+      himalaya::HierarchyCalculator hc(pars);
+      hc.init();
+
+      himalaya::HierarchyObject ho(false);
+      ho.setMDRFlag(0);
+      ho.setSuitableHierarchy(i);
+
+      const auto hier_str = ho.getH3mHierarchyNotation(i);
+
+      INFO("Checking hierarchy " << i << " (" << hier_str << ")");
+
+      const Eigen::Matrix2d massMatrix = treelvl + hc.getMt41L(ho, 0, 0);
+
+      for (int loopOrder = 2; loopOrder <= 3; loopOrder++) {
+         const int twoLoopFlag = loopOrder == 2 ? 1 : 0;
+         const int threeLoopFlag = loopOrder == 3 ? 1 : 0;
+
+         // expansion depth as set by compareHierarchies
+         ExpansionFlags flags;
+         flags.set(ExpansionDepth::xx, 0);
+         flags.set(ExpansionDepth::xxMst, 0);
+
+         const double uncertainty = hc.getExpansionUncertainty(
+            ho, massMatrix, 0, twoLoopFlag, threeLoopFlag, flags);
+
+         flags.set(ExpansionDepth::xxMst, 1);
+
+         Eigen::EigenSolver<Eigen::Matrix2d> es(massMatrix
+            + hc.calculateHierarchy(ho, 0, twoLoopFlag, threeLoopFlag, flags, nullptr), false);
+         const double Mh = calcLowestMass(es);
+
+         double squaredErrorSum = 0.;
+         for (const auto var: truncatedVariables.at(hc.getCorrectHierarchy(i))) {
+            auto truncatedFlags = flags;
+            truncatedFlags.set(var, 0);
+            es.compute(massMatrix
+               + hc.calculateHierarchy(ho, 0, twoLoopFlag, threeLoopFlag, truncatedFlags, nullptr), false);
+            const double Mhcut = calcLowestMass(es);
+            squaredErrorSum += (Mh - Mhcut)*(Mh - Mhcut);
+         }
+
+         CHECK_CLOSE(uncertainty, std::sqrt(squaredErrorSum), 1e-6);
+      }
+   }
+}
+
+TEST_CASE("test_expansion_flags")
+{
+   using namespace himalaya;
+
+   ExpansionFlags flags;
+   CHECK(flags.isFull());
+   CHECK(flags.getBits() == ExpansionFlags::FULL);
+
+   for (int i = ExpansionDepth::FIRST; i < ExpansionDepth::NUMBER_OF_EXPANSIONS; i++) {
+      const auto var = static_cast<ExpansionDepth::ExpansionDepth>(i);
+      CHECK(flags.at(var) == 1);
+
+      auto truncated = flags;
+      truncated.set(var, 0);
+      CHECK(!truncated.isFull());
+      CHECK(truncated != flags);
+
+      for (int k = ExpansionDepth::FIRST; k < ExpansionDepth::NUMBER_OF_EXPANSIONS; k++) {
+         const auto other = static_cast<ExpansionDepth::ExpansionDepth>(k);
+         CHECK(truncated.at(other) == (k == i ? 0u : 1u));
+      }
+
+      truncated.set(var, 1);
+      CHECK(truncated == flags);
+   }
+
+   // the flags can be evaluated at compile time
+   static_assert(ExpansionFlags().at(ExpansionDepth::xxMgl) == 1, "");
+   static_assert(ExpansionFlags(0u).at(ExpansionDepth::xxMgl) == 0, "");
+   static_assert(ExpansionFlags(~0u).isFull(), "");
+}
+
+namespace {
+
+template <typename T>
+himalaya::Kinematics<T> make_kinematics()
+{
+   const T scale = 1973.75, tbeta = T(236.115)/T(49.5751);
+
+   himalaya::Kinematics<T> k;
+   k.Al4p = 0.00670537;
+   k.Tbeta = tbeta;
+   k.Sbeta = std::sin(std::atan(tbeta));
+   k.Cbeta = std::cos(std::atan(tbeta));
+   k.scale = scale;
+   k.MuSUSY = 1999.82;
+   k.At = 6992.34;
+   k.Mt = 147.295;
+   k.s2t = -0.999995;
+   k.Mgl = 2000.96;
+   k.Msq = 2000.7;
+   k.lmMt = std::log(scale*scale/(k.Mt*k.Mt));
+   k.lmMgl = std::log(scale*scale/(k.Mgl*k.Mgl));
+   k.lmMsq = std::log(scale*scale/(k.Msq*k.Msq));
+   k.setStopMasses(1745.3, 2232.1);
+
+   return k;
+}
+
+template <typename T>
+himalaya::H3<T> make_H3()
+{
+   return himalaya::H3<T>(himalaya::ExpansionFlags(), make_kinematics<T>(), 0);
+}
+
+template <typename T>
+himalaya::H6b<T> make_H6b()
+{
+   return himalaya::H6b<T>(himalaya::ExpansionFlags(), make_kinematics<T>(), 1);
+}
+
+/// compares the expressions of a hierarchy evaluated with two scalar types
+template <typename A, typename B>
+void check_scalar_types(const A& a, const B& b, double eps)
+{
+   CHECK_CLOSE(a.getS1ThreeLoop(), static_cast<double>(b.getS1ThreeLoop()), eps);
+   CHECK_CLOSE(a.getS2ThreeLoop(), static_cast<double>(b.getS2ThreeLoop()), eps);
+   CHECK_CLOSE(a.getS12ThreeLoop(), static_cast<double>(b.getS12ThreeLoop()), eps);
+   CHECK_CLOSE(a.getS2TwoLoopTruncations()[0], static_cast<double>(b.getS2TwoLoopTruncations()[0]), eps);
+   CHECK_CLOSE(a.calc_coefs_at_as2_no_sm_logs().log0, static_cast<double>(b.calc_coefs_at_as2_no_sm_logs().log0), eps);
+   CHECK_CLOSE(a.calc_coefs_at_as2_no_sm_logs().log1, static_cast<double>(b.calc_coefs_at_as2_no_sm_logs().log1), eps);
+}
+
+} // anonymous namespace
+
+TEST_CASE("test_scalar_types")
+{
+   check_scalar_types(make_H3<double>(), make_H3<long double>(), 1e-10);
+   check_scalar_types(make_H6b<double>(), make_H6b<long double>(), 1e-10);
+}
+
+TEST_CASE("test_log_coefficients")
+{
+   const auto c3 = make_H3<double>().calc_coefs_at_as2_no_sm_logs();
+   CHECK_CLOSE(c3.log0, 7976.212795755382, 1e-12);
+   CHECK_CLOSE(c3.log1, 458.1965331616651, 1e-12);
+   CHECK_CLOSE(c3.log2, -1845.281070096786, 1e-12);
+   CHECK_CLOSE(c3.log3, -298.6666666666667, 1e-12);
+
+   const auto c6b = make_H6b<double>().calc_coefs_at_as2_no_sm_logs();
+   CHECK_CLOSE(c6b.log0, 1960921.143332401, 1e-12);
+   CHECK_CLOSE(c6b.log1, 1290049.005215969, 1e-12);
+   CHECK_CLOSE(c6b.log2, 475136.8814205847, 1e-12);
+   CHECK_CLOSE(c6b.log3, -298.6666666666667, 1e-12);
+
+   for (const double lmMst1: {-1., 0., 0.5, 2.}) {
+      CHECK_CLOSE(c3.eval(lmMst1), c3.log0 + lmMst1*c3.log1 + lmMst1*lmMst1*c3.log2
+                  + lmMst1*lmMst1*lmMst1*c3.log3, 1e-12);
+   }
+}
+
+/// returns n parameter points around make_point()
+std::vector<himalaya::Kinematics<double>> make_points(int n)
+{
+   std::vector<himalaya::Kinematics<double>> points(n, make_kinematics<double>());
+
+   for (int i = 0; i < n; i++) {
+      auto& k = points[i];
+      k.scale += 10*i;
+      k.Tbeta = std::tan(std::atan(k.Tbeta) - 0.01*i);
+      k.Sbeta = std::sin(std::atan(k.Tbeta));
+      k.Cbeta = std::cos(std::atan(k.Tbeta));
+      k.s2t += 0.01*i;
+      k.lmMt = std::log(k.scale*k.scale/(k.Mt*k.Mt));
+      k.setStopMasses(1745.3 + 5*i, 2232.1 - 3*i);
+   }
+
+   return points;
+}
+
+TEST_CASE("test_simd_pack")
+{
+   using namespace himalaya;
+   typedef SimdPack<SIMD_WIDTH> Pack;
+
+   // parameter points, the last pack is incomplete
+   const int n = 2*SIMD_WIDTH - 1;
+   const auto points = make_points(n);
+
+   KinematicsBatch batch;
+   for (const auto& k: points) {
+      appendPoint(batch, k);
+   }
+
+   for (int i = 0; i < n; i += SIMD_WIDTH) {
+      const int m = std::min(n - i, SIMD_WIDTH);
+
+      // gathers the variables of the points into packs
+      Kinematics<Pack> k;
+      forEachVariable(k, batch, [i, m] (Pack& x, const std::vector<double>& v) {
+         x = Pack::load(v.data() + i, m);
+      });
+
+      const H6b<Pack> packed(ExpansionFlags(), k, 1);
+
+      double S1[SIMD_WIDTH], S2[SIMD_WIDTH], S12[SIMD_WIDTH], c0[SIMD_WIDTH];
+      packed.getS1ThreeLoop().store(S1, m);
+      packed.getS2ThreeLoop().store(S2, m);
+      packed.getS12ThreeLoop().store(S12, m);
+      packed.calc_coefs_at_as2_no_sm_logs().log0.store(c0, m);
+
+      for (int k = 0; k < m; k++) {
+         const int p = i + k;
+         const H6b<double> single(ExpansionFlags(), points[p], 1);
+
+         INFO("Checking point " << p);
+         CHECK_CLOSE(S1[k], single.getS1ThreeLoop(), 1e-12);
+         CHECK_CLOSE(S2[k], single.getS2ThreeLoop(), 1e-12);
+         CHECK_CLOSE(S12[k], single.getS12ThreeLoop(), 1e-12);
+         CHECK_CLOSE(c0[k], single.calc_coefs_at_as2_no_sm_logs().log0, 1e-12);
+         CHECK_CLOSE(packed.getS2TwoLoop()[k], single.getS2TwoLoop(), 1e-12);
+      }
+   }
+}
+
+TEST_CASE("test_simd_batch")
+{
+   using namespace himalaya;
+
+   // the last pack is incomplete for both widths
+   const int n = 13;
+   const auto points = make_points(n);
+
+   KinematicsBatch batch;
+   for (const auto& k: points) {
+      appendPoint(batch, k);
+   }
+
+   const auto r4 = calculateThreeLoopBatch<H6b, 4>(batch, ExpansionFlags(), 1);
+   const auto r8 = calculateThreeLoopBatch<H6b, 8>(batch, ExpansionFlags(), 1);
+
+   REQUIRE(r4.S1.size() == n);
+   REQUIRE(r8.S1.size() == n);
+
+   for (int p = 0; p < n; p++) {
+      const H6b<double> single(ExpansionFlags(), points[p], 1);
+      const auto c = single.calc_coefs_at_as2_no_sm_logs();
+
+      INFO("Checking point " << p);
+      for (const auto* r: {&r4, &r8}) {
+         CHECK_CLOSE(r->S1[p], single.getS1ThreeLoop(), 1e-12);
+         CHECK_CLOSE(r->S2[p], single.getS2ThreeLoop(), 1e-12);
+         CHECK_CLOSE(r->S12[p], single.getS12ThreeLoop(), 1e-12);
+         CHECK_CLOSE(r->log0[p], c.log0, 1e-12);
+         CHECK_CLOSE(r->log1[p], c.log1, 1e-12);
+         CHECK_CLOSE(r->log2[p], c.log2, 1e-12);
+         CHECK_CLOSE(r->log3[p], c.log3, 1e-12);
+      }
+   }
+}
+
+TEST_CASE("test_hierarchy_pruning")
+{
+   using namespace himalaya;
+
+   int skipped = 0;
+
+   for (const double mg: {0.75, 0.9, 1.0, 1.15, 1.25}) {
+      for (const double mst: {0.8, 0.9, 1.0, 1.1}) {
+         auto point = make_point();
+         point.MG *= mg;
+         point.MSt(0) *= mst;
+
+         for (const bool isAlphab: {false, true}) {
+            HierarchyCalculator hc(point, false);
+            HierarchyObject exhaustive(isAlphab), pruned(isAlphab);
+
+            const int hierarchy = hc.compareHierarchies(exhaustive);
+            hc.setHierarchyPruning(true);
+            const int prunedHierarchy = hc.compareHierarchies(pruned);
+
+            INFO("Checking MG * " << mg << ", MSt1 * " << mst << ", isAlphab = " << isAlphab);
+            CHECK(prunedHierarchy == hierarchy);
+            CHECK(pruned.getSuitableHierarchy() == exhaustive.getSuitableHierarchy());
+            CHECK(pruned.getAbsDiff2L() == exhaustive.getAbsDiff2L());
+            CHECK(pruned.getRelDiff2L() == exhaustive.getRelDiff2L());
+            CHECK(pruned.getDMhExpUncertainty(2) == exhaustive.getDMhExpUncertainty(2));
+            CHECK(pruned.getDMhExpUncertainty(3) == exhaustive.getDMhExpUncertainty(3));
+            CHECK(exhaustive.getSkippedUncertaintyEstimates() == 0);
+
+            skipped += pruned.getSkippedUncertaintyEstimates();
+         }
+      }
+   }
+
+   CHECK(skipped > 0);
+}
+
+TEST_CASE("test_result_fields")
+{
+   using namespace himalaya;
+
+   const HierarchyCalculator hc(make_point(), false);
+
+   for (const bool isAlphab: {false, true}) {
+      INFO("Checking isAlphab = " << isAlphab);
+
+      const auto all = hc.calculateDMh3L(isAlphab);
+      const auto dmh = hc.calculateDMh3L(isAlphab, ResultFields::DMH);
+      const auto dlambda = hc.calculateDMh3L(isAlphab, ResultFields::DLAMBDA);
+      const auto eft = hc.calculateDMh3L(isAlphab, ResultFields::EFT);
+      const auto mdr = hc.calculateDMh3L(isAlphab, ResultFields::MDR_SHIFT);
+
+      CHECK(all.getResultFields() == ResultFields::ALL);
+      CHECK(dmh.getResultFields() == ResultFields::DMH);
+      CHECK(dlambda.getResultFields() == ResultFields::DLAMBDA);
+      CHECK(eft.getResultFields() == (ResultFields::EFT | ResultFields::DLAMBDA));
+      CHECK(mdr.getResultFields() == (ResultFields::MDR_SHIFT | ResultFields::DMH));
+
+      for (const auto& ho: {dmh, dlambda, eft, mdr}) {
+         CHECK(ho.getSuitableHierarchy() == all.getSuitableHierarchy());
+         CHECK(ho.getAbsDiff2L() == all.getAbsDiff2L());
+      }
+
+      for (int loops = 1; loops <= 3; loops++) {
+         CHECK(dmh.getDMh(loops) == all.getDMh(loops));
+         CHECK(mdr.getDMh(loops) == all.getDMh(loops));
+      }
+      CHECK(mdr.getDMhDRbarPrimeToMDRbarPrimeShift() == all.getDMhDRbarPrimeToMDRbarPrimeShift());
+      CHECK(mdr.getMDRMasses() == all.getMDRMasses());
+
+      for (int loops = 0; loops <= 3; loops++) {
+         CHECK(dlambda.getDLambda(loops) == all.getDLambda(loops));
+         CHECK(dlambda.getDLambdaDRbarPrimeToMSbarShift(loops) == all.getDLambdaDRbarPrimeToMSbarShift(loops));
+         CHECK(eft.getDMh2EFT(loops) == all.getDMh2EFT(loops));
+      }
+      CHECK(dlambda.getDLambdaH3m() == all.getDLambdaH3m());
+      CHECK(dlambda.getDLambdaNonLog() == all.getDLambdaNonLog());
+
+      // results, which have not been requested, are not available
+      CHECK_THROWS(dmh.getDLambda(3));
+      CHECK_THROWS(dlambda.getDMh(3));
+      CHECK_THROWS(dlambda.getDMh2EFT(3));
+
+      std::ostringstream ostr;
+      for (const auto& ho: {all, dmh, dlambda, eft, mdr}) {
+         CHECK_NOTHROW(ostr << ho);
+      }
+   }
+}
+
+/**
+ * Returns the lowest eigenvalue of a real symmetric 2x2 matrix in long
+ * double precision, which is refined by Newton steps on the
+ * characteristic polynomial to a high relative precision.
+ */
+double calcLowestEigenvalueReference(const Eigen::Matrix2d& matrix)
+{
+   typedef Eigen::Matrix<long double, 2, 2> Matrix2ld;
+   const Matrix2ld m = matrix.cast<long double>();
+   const Eigen::SelfAdjointEigenSolver<Matrix2ld> es(m, Eigen::EigenvaluesOnly);
+
+   long double x = es.eigenvalues()(0);
+   for (int i = 0; i < 3; i++) {
+      const long double p = (m(0,0) - x)*(m(1,1) - x) - m(0,1)*m(0,1);
+      const long double dp = 2*x - m(0,0) - m(1,1);
+      if (dp != 0) {
+         x -= p/dp;
+      }
+   }
+
+   return static_cast<double>(x);
+}
+
+TEST_CASE("test_lowest_eigenvalue")
+{
+   using namespace himalaya;
+
+   std::vector<Eigen::Matrix2d> matrices;
+
+   // tree-level like matrices with large hierarchies, degenerate and diagonal matrices
+   for (const double tbeta: {1.5, 5., 20., 50.}) {
+      for (const double MA: {50., 500., 5000.}) {
+         const double s2b = std::sin(2*std::atan(tbeta));
+         const double MZ = 91.;
+         Eigen::Matrix2d m;
+         m(0,0) = s2b/2.*(MZ*MZ / tbeta + MA*MA * tbeta);
+         m(0,1) = m(1,0) = s2b/2.*(-MZ*MZ - MA*MA);
+         m(1,1) = s2b/2.*(MZ*MZ * tbeta + MA*MA / tbeta);
+         matrices.push_back(m);
+      }
+   }
+
+   matrices.push_back((Eigen::Matrix2d() << 2., 0., 0., 2.).finished());
+   matrices.push_back((Eigen::Matrix2d() << 3., 0., 0., -1.).finished());
+   matrices.push_back((Eigen::Matrix2d() << 1e6, 1e-3, 1e-3, 1e-6).finished());
+
+   std::vector<double> eigenvalues(matrices.size());
+   calcLowestEigenvalues(matrices.data(), matrices.size(), eigenvalues.data());
+
+   for (std::size_t i = 0; i < matrices.size(); i++) {
+      INFO("Checking matrix " << i);
+      const double expected = calcLowestEigenvalueReference(matrices[i]);
+      CHECK_CLOSE(calcLowestEigenvalue(matrices[i]), expected, 1e-12);
+      CHECK(eigenvalues[i] == calcLowestEigenvalue(matrices[i]));
+   }
+}
+
+/// returns the input parameter of a gradient variable
+double& gradient_variable(himalaya::Parameters& pars, bool isAlphab, int i)
+{
+   using namespace himalaya::GradientVariables;
+
+   switch (i) {
+   case MST1: return isAlphab ? pars.MSb(0) : pars.MSt(0);
+   case MST2: return isAlphab ? pars.MSb(1) : pars.MSt(1);
+   case S2T: return isAlphab ? pars.s2b : pars.s2t;
+   case MG: return pars.MG;
+   case AT: return isAlphab ? pars.Ad(2,2) : pars.Au(2,2);
+   case MU: return pars.mu;
+   case SCALE: return pars.scale;
+   case G3: return pars.g3;
+   case VU: return pars.vu;
+   default: return pars.vd;
+   }
+}
+
+TEST_CASE("test_gradients")
+{
+   using namespace himalaya;
+
+   const auto pars = make_point();
+   const HierarchyCalculator hc(pars, false);
+
+   for (const bool isAlphab: {false, true}) {
+      INFO("Checking isAlphab = " << isAlphab);
+
+      const auto ho = hc.calculateDMh3L(isAlphab);
+      const auto g = hc.calculateGradients3L(ho);
+      const int hierarchy = ho.getSuitableHierarchy();
+
+      CHECK(g.hierarchy == hierarchy);
+      for (int k = 0; k < 4; k++) {
+         CHECK_CLOSE(g.DMh3L(k), ho.getDMh(3)(k), 1e-10);
+      }
+      if (!isAlphab) {
+         CHECK_CLOSE(g.DLambda3L, ho.getDLambda(3), 1e-10);
+      } else {
+         CHECK(g.DLambda3L == 0.);
+      }
+
+      // compare with central differences of the full calculation
+      for (int i = 0; i < GradientVariables::NUMBER_OF_GRADIENT_VARIABLES; i++) {
+         INFO("Checking gradient variable " << i);
+         auto up = pars, down = pars;
+         const double x = gradient_variable(up, isAlphab, i);
+         const double h = 1e-4*std::max(1., std::abs(x));
+         gradient_variable(up, isAlphab, i) = i == GradientVariables::S2T ? std::min(x + h, 1.) : x + h;
+         gradient_variable(down, isAlphab, i) = i == GradientVariables::S2T ? std::max(x - h, -1.) : x - h;
+         const double dx = gradient_variable(up, isAlphab, i) - gradient_variable(down, isAlphab, i);
+
+         const auto ho_up = HierarchyCalculator(up, false).calculateDMh3L(isAlphab);
+         const auto ho_down = HierarchyCalculator(down, false).calculateDMh3L(isAlphab);
+         const int hierarchy_up = ho_up.getSuitableHierarchy();
+         const int hierarchy_down = ho_down.getSuitableHierarchy();
+         REQUIRE(hierarchy_up == hierarchy);
+         REQUIRE(hierarchy_down == hierarchy);
+
+         const Eigen::Matrix2d dMh = (ho_up.getDMh(3) - ho_down.getDMh(3))/dx;
+         const double diff = (dMh - g.DMh3LGradient[i]).cwiseAbs().maxCoeff();
+         CHECK(diff <= 1e-3*std::max(dMh.cwiseAbs().maxCoeff(), 1e-8));
+
+         if (!isAlphab) {
+            const double dLambda = (ho_up.getDLambda(3) - ho_down.getDLambda(3))/dx;
+            CHECK(std::abs(dLambda - g.DLambda3LGradient[i]) <= 1e-3*std::max(std::abs(dLambda), 1e-12));
+         }
+      }
+   }
+
+   auto ho = hc.calculateDMh3L(false);
+   ho.setMDRFlag(1);
+   CHECK_THROWS(hc.calculateGradients3L(ho));
+}
+
+TEST_CASE("test_scale_dependence")
+{
+   using namespace himalaya;
+
+   const auto pars = make_point();
+   const HierarchyCalculator hc(pars, false);
+
+   for (const bool isAlphab: {false, true}) {
+      INFO("Checking isAlphab = " << isAlphab);
+
+      const auto ho = hc.calculateDMh3L(isAlphab);
+      const auto sd = hc.calculateScaleDependence3L(ho);
+      const int hierarchy = ho.getSuitableHierarchy();
+      CHECK(sd.hierarchy == hierarchy);
+
+      // compare with the full calculation at other scales, where the same hierarchy is suitable
+      int checkedScales = 0;
+      for (const double factor: {1., 0.7, 1.6}) {
+         INFO("Checking scale factor " << factor);
+         auto q = pars;
+         q.scale *= factor;
+         const auto hoq = HierarchyCalculator(q, false).calculateDMh3L(isAlphab);
+         if (hoq.getSuitableHierarchy() != hierarchy)
+            continue;
+         checkedScales++;
+
+         const double lmMst1 = sd.getLogarithm(q.scale);
+         const Eigen::Matrix2d dMh3L = sd.DMh3L.eval(lmMst1);
+         for (int k = 0; k < 4; k++) {
+            CHECK_CLOSE(dMh3L(k), hoq.getDMh(3)(k), 1e-8);
+         }
+
+         if (isAlphab) {
+            CHECK(sd.DLambda3L.eval(lmMst1) == 0.);
+            continue;
+         }
+
+         CHECK_CLOSE(sd.DLambda3L.eval(lmMst1), hoq.getDLambda(3), 1e-8);
+
+         auto q_mass_ES = q;
+         q_mass_ES.mu2(2,2) = pow2(q.MSt(0));
+         q_mass_ES.mq2(2,2) = pow2(q.MSt(1));
+         ThresholdCalculator tc(q_mass_ES, std::numeric_limits<double>::quiet_NaN(), false);
+         for (int variable = ThresholdVariables::FIRST;
+              variable < ThresholdVariables::NUMBER_OF_THRESHOLD_VARIALES; variable++) {
+            // the expression of lambda_ytau6 cancels numerically for nearly degenerate stau masses
+            if (variable == ThresholdVariables::LAMBDA_YTAU6)
+               continue;
+            INFO("Checking threshold variable " << variable);
+            CHECK_CLOSE(sd.thresholdCorrections[variable].eval(lmMst1),
+                        tc.getThresholdCorrection(variable, RenSchemes::DRBARPRIME, 1), 1e-7);
+         }
+      }
+      CHECK(checkedScales >= 2);
+   }
+
+   auto ho = hc.calculateDMh3L(false);
+   ho.setMDRFlag(1);
+   CHECK_THROWS(hc.calculateScaleDependence3L(ho));
+}
+
+TEST_CASE("test_Xt_dependence")
+{
+   using namespace himalaya;
+
+   const auto pars = make_point();
+   const HierarchyCalculator hc(pars, false);
+   const auto ho = hc.calculateDMh3L(false);
+   const auto xd = hc.calculateXtDependence3L(ho);
+   const int hierarchy = ho.getSuitableHierarchy();
+   CHECK(xd.hierarchy == hierarchy);
+
+   // compare with the full calculation at fixed stop masses, where the same hierarchy is suitable
+   const double range = (pow2(pars.MSt(1)) - pow2(pars.MSt(0)))/(2*pars.Mt);
+   int checkedXt = 0;
+   for (const double x: {-0.8, -0.3, 0.1, 0.6, 0.95}) {
+      const double Xt = x*range;
+      INFO("Checking Xt = " << Xt);
+      auto q = pars;
+      q.Au(2,2) = Xt + q.mu*q.vd/q.vu;
+      q.s2t = 2*q.Mt*Xt/(pow2(q.MSt(0)) - pow2(q.MSt(1)));
+      const auto hoq = HierarchyCalculator(q, false).calculateDMh3L(false);
+      if (hoq.getSuitableHierarchy() != hierarchy)
+         continue;
+      checkedXt++;
+
+      for (int loops = 0; loops < 4; loops++) {
+         INFO("Checking loop order " << loops);
+         CHECK_CLOSE(xd.DLambda[loops].eval(Xt), hoq.getDLambda(loops), 1e-8);
+         CHECK_CLOSE(xd.DLambdaDRbarPrimeToMSbarShift[loops].eval(Xt), hoq.getDLambdaDRbarPrimeToMSbarShift(loops), 1e-8);
+      }
+   }
+   CHECK(checkedXt >= 2);
+
+   CHECK_THROWS(hc.calculateXtDependence3L(hc.calculateDMh3L(true)));
+}
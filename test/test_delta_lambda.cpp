@@ -1,6 +1,7 @@
 #include "doctest.h"
 #include "HierarchyCalculator.hpp"
 #include "Mh2EFTCalculator.hpp"
+#include <vector>
 
 
 #define CHECK_CLOSE(a,b,eps) CHECK((a) == doctest::Approx(b).epsilon(eps))
@@ -251,3 +252,33 @@ TEST_CASE("test_lambda_limit_degenerate")
 
    CHECK_CLOSE(z2_gen_Himalaya, z2_gen_EFT, uncertainty);
 }
+
+TEST_CASE("test_delta_lambda_3L")
+{
+   using namespace himalaya;
+
+   std::vector<Parameters> points = {make_point(), make_degenerate_point(0.03)};
+   for (const double mg: {0.5, 2.}) {
+      auto pars = make_point();
+      pars.MG *= mg;
+      points.push_back(pars);
+   }
+
+   for (const auto& pars: points) {
+      const HierarchyCalculator hc(pars, false);
+      const auto ho = hc.calculateDMh3L(false);
+      const auto dl = hc.calculateDLambda3L();
+      const auto dlWithUncertainty = hc.calculateDLambda3L(true);
+
+      const int hierarchy = ho.getSuitableHierarchy();
+      INFO("hierarchy: " << hierarchy);
+
+      CHECK(dl.hierarchy == hierarchy);
+      CHECK(dl.dLambda == ho.getDLambda(3));
+      CHECK(dl.dLambdaDRbarPrimeToMSbarShift == ho.getDLambdaEFTDRbarPrimeToMSbarShift());
+      CHECK(dl.dLambdaExpUncertainty == 0.);
+      CHECK(dlWithUncertainty.dLambda == dl.dLambda);
+      CHECK_CLOSE(std::abs(dlWithUncertainty.dLambdaXtUncertainty) + std::abs(dlWithUncertainty.dLambdaExpUncertainty),
+                  ho.getDLambdaEFTUncertainty(), 1e-12);
+   }
+}
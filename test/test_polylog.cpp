@@ -0,0 +1,86 @@
+#include "doctest.h"
+#include "Polylog.hpp"
+#include "dilog.h"
+#include <cmath>
+#include <vector>
+
+namespace {
+
+const double Pi = 3.1415926535897932384626433832795;
+
+/// arguments in all ranges of the reduction
+std::vector<double> make_arguments()
+{
+   std::vector<double> x;
+   for (int i = -400; i <= 400; i++) {
+      x.push_back(i/100.);
+   }
+   for (int i = -12; i <= 6; i++) {
+      x.push_back(std::pow(10., i));
+      x.push_back(-std::pow(10., i));
+      x.push_back(1. + std::pow(10., i - 6));
+      x.push_back(1. - std::pow(10., i - 6));
+   }
+   return x;
+}
+
+} // anonymous namespace
+
+TEST_CASE("test_dilog_values")
+{
+   CHECK(himalaya::dilog(0.) == 0.);
+   CHECK(himalaya::dilog(1e-20) == doctest::Approx(1e-20).epsilon(1e-15));
+   CHECK(himalaya::dilog(1.) == doctest::Approx(Pi*Pi/6).epsilon(1e-15));
+   CHECK(himalaya::dilog(-1.) == doctest::Approx(-Pi*Pi/12).epsilon(1e-15));
+   CHECK(himalaya::dilog(0.5) == doctest::Approx(Pi*Pi/12 - std::log(2.)*std::log(2.)/2).epsilon(1e-15));
+   CHECK(himalaya::dilog(2.) == doctest::Approx(Pi*Pi/4).epsilon(1e-15));
+}
+
+TEST_CASE("test_dilog_scalar_and_batch")
+{
+   const auto x = make_arguments();
+   std::vector<double> li2(x.size());
+   himalaya::dilog(x.data(), x.size(), li2.data());
+
+   for (std::size_t i = 0; i < x.size(); i++) {
+      const double ref = gm2calc::dilog(x[i]);
+      INFO("x = " << x[i]);
+      // absolute at the zero of Re Li2(x) near x = 12.6 and for large |x|
+      CHECK(std::abs(himalaya::dilog(x[i]) - ref) <= 1e-14*std::max(1., std::abs(ref)));
+      CHECK(li2[i] == doctest::Approx(himalaya::dilog(x[i])).epsilon(1e-15));
+   }
+}
+
+TEST_CASE("test_clausen_values")
+{
+   const double catalan = 0.91596559417721901505;
+   const double cl2_pi_3 = 1.0149416064096536250;
+
+   CHECK(himalaya::clausen_2(0.) == 0.);
+   CHECK(std::abs(himalaya::clausen_2(Pi)) < 1e-15);
+   CHECK(himalaya::clausen_2(Pi/2) == doctest::Approx(catalan).epsilon(1e-15));
+   CHECK(himalaya::clausen_2(Pi/3) == doctest::Approx(cl2_pi_3).epsilon(1e-15));
+   CHECK(himalaya::clausen_2(2*Pi/3) == doctest::Approx(2./3*cl2_pi_3).epsilon(1e-15));
+   CHECK(himalaya::clausen_2(-Pi/2) == doctest::Approx(-catalan).epsilon(1e-15));
+   CHECK(himalaya::clausen_2(Pi/2 + 4*Pi) == doctest::Approx(catalan).epsilon(1e-14));
+   CHECK(himalaya::clausen_2(1e-10) == doctest::Approx(1e-10*(1 - std::log(1e-10))).epsilon(1e-15));
+}
+
+TEST_CASE("test_clausen_scalar_and_batch")
+{
+   std::vector<double> x;
+   for (int i = -1000; i <= 1000; i++) {
+      x.push_back(i/100.);
+   }
+
+   std::vector<double> cl2(x.size());
+   himalaya::clausen_2(x.data(), x.size(), cl2.data());
+
+   for (std::size_t i = 0; i < x.size(); i++) {
+      INFO("x = " << x[i]);
+      // duplication formula Cl2(2x) = 2 Cl2(x) - 2 Cl2(pi - x)
+      const double dup = 2*himalaya::clausen_2(x[i]) - 2*himalaya::clausen_2(Pi - x[i]);
+      CHECK(std::abs(himalaya::clausen_2(2*x[i]) - dup) <= 1e-14);
+      CHECK(cl2[i] == doctest::Approx(himalaya::clausen_2(x[i])).epsilon(1e-15));
+   }
+}
@@ -0,0 +1,275 @@
+#include "doctest.h"
+#include "HierarchyCalculator.hpp"
+#include "ThreadPool.hpp"
+#include <atomic>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+himalaya::Parameters make_point(double eps = 0.)
+{
+   himalaya::Parameters pars;
+
+   pars.scale = 1973.75;
+   pars.mu = 1999.82;
+   pars.g3 =  1.02907;
+   pars.vd = 49.5751;
+   pars.vu = 236.115;
+   pars.mq2 <<  4.00428e+06 , 0, 0,
+               0, 4.00428e+06, 0,
+               0, 0, 3.99786e+06*(1 + eps);
+   pars.md2 << 4.00361e+06, 0, 0,
+               0, 4.00361e+06, 0,
+               0, 0, 4.00346e+06;
+   pars.mu2 << 4.00363e+06 , 0, 0,
+               0, 4.00363e+06, 0,
+               0, 0, 3.99067e+06*(1 - eps);
+   pars.Ad << 0, 0, 0, 0, 0, 0, 0, 0,  9996.81;
+   pars.Au << 0, 0, 0, 0, 0, 0, 0, 0,  6992.34;
+
+   pars.MA = 1992.14;
+   pars.MG = 2000.96*(1 + eps);
+   pars.MW = 76.7777;
+   pars.MZ = 88.4219;
+   pars.Mt = 147.295;
+   pars.Mb = 2.23149;
+
+   return pars;
+}
+
+/// relevant results of calculateDMh3L
+struct Result {
+   int hierarchy{-1};
+   Eigen::Matrix2d DMh3L{Eigen::Matrix2d::Zero()};
+   Eigen::Matrix2d DMhMDRShift{Eigen::Matrix2d::Zero()};
+   double expUncertainty{0.};
+   double deltaLambdaEFT{0.};
+};
+
+Result make_result(const himalaya::HierarchyObject& ho)
+{
+   Result result;
+   result.hierarchy = ho.getSuitableHierarchy();
+   result.DMh3L = ho.getDMh(3);
+   result.DMhMDRShift = ho.getDMhDRbarPrimeToMDRbarPrimeShift();
+   result.expUncertainty = ho.getDMhExpUncertainty(3);
+   result.deltaLambdaEFT = ho.getDLambdaEFT();
+   return result;
+}
+
+bool operator==(const Result& a, const Result& b)
+{
+   return a.hierarchy == b.hierarchy
+      && a.DMh3L == b.DMh3L
+      && a.DMhMDRShift == b.DMhMDRShift
+      && a.expUncertainty == b.expUncertainty
+      && a.deltaLambdaEFT == b.deltaLambdaEFT;
+}
+
+const int number_of_threads = 8;
+const int number_of_calls = 10;
+
+} // anonymous namespace
+
+TEST_CASE("test_shared_calculator")
+{
+   const himalaya::HierarchyCalculator hc(make_point(), false);
+
+   const Result expected = make_result(hc.calculateDMh3L(false));
+
+   std::vector<std::vector<Result>> results(number_of_threads);
+   std::vector<std::thread> threads;
+
+   for (int t = 0; t < number_of_threads; t++) {
+      threads.emplace_back([&hc, &results, t] {
+         for (int i = 0; i < number_of_calls; i++) {
+            results[t].push_back(make_result(hc.calculateDMh3L(false)));
+         }
+      });
+   }
+
+   for (auto& thread: threads) {
+      thread.join();
+   }
+
+   for (const auto& res: results) {
+      REQUIRE(res.size() == number_of_calls);
+      for (const auto& r: res) {
+         CHECK(r == expected);
+      }
+   }
+}
+
+TEST_CASE("test_concurrent_calculators")
+{
+   // compute the reference results serially
+   std::vector<Result> expected;
+   for (int t = 0; t < number_of_threads; t++) {
+      const himalaya::HierarchyCalculator hc(make_point(0.01*t), false);
+      expected.push_back(make_result(hc.calculateDMh3L(false)));
+   }
+
+   std::vector<Result> results(number_of_threads);
+   std::vector<std::thread> threads;
+
+   // construct the calculators concurrently, which prints the banner only once
+   for (int t = 0; t < number_of_threads; t++) {
+      threads.emplace_back([&results, t] {
+         const himalaya::HierarchyCalculator hc(make_point(0.01*t));
+         for (int i = 0; i < number_of_calls; i++) {
+            results[t] = make_result(hc.calculateDMh3L(false));
+         }
+      });
+   }
+
+   for (auto& thread: threads) {
+      thread.join();
+   }
+
+   for (int t = 0; t < number_of_threads; t++) {
+      INFO("Checking thread " << t);
+      CHECK(results[t] == expected[t]);
+   }
+}
+
+TEST_CASE("test_thread_pool")
+{
+   const std::size_t number_of_tasks = 1000;
+
+   for (unsigned int workers = 1; workers <= 4; workers++) {
+      himalaya::ThreadPool pool(workers);
+      REQUIRE(pool.getNumberOfWorkers() == workers);
+
+      // the pool is reused for several batches
+      for (int batch = 0; batch < 3; batch++) {
+         std::vector<std::atomic<int>> calls(number_of_tasks);
+         for (auto& c: calls) {
+            c = 0;
+         }
+
+         pool.run(number_of_tasks, [&calls] (std::size_t i) { calls[i]++; });
+
+         for (const auto& c: calls) {
+            CHECK(c == 1);
+         }
+      }
+
+      // all tasks are run, even if one throws
+      std::atomic<int> count(0);
+      CHECK_THROWS_AS(pool.run(number_of_tasks, [&count] (std::size_t i) {
+         count++;
+         if (i == 10) {
+            throw std::runtime_error("task failed");
+         }
+      }), std::runtime_error);
+      CHECK(count == number_of_tasks);
+   }
+}
+
+TEST_CASE("test_batch")
+{
+   std::vector<himalaya::Parameters> points;
+   for (int i = 0; i < 20; i++) {
+      points.push_back(make_point(0.005*i));
+   }
+
+   for (const bool isAlphab: {false, true}) {
+      std::vector<Result> expected;
+      for (const auto& point: points) {
+         const himalaya::HierarchyCalculator hc(point, false);
+         expected.push_back(make_result(hc.calculateDMh3L(isAlphab)));
+      }
+
+      for (unsigned int workers = 0; workers <= 3; workers++) {
+         const auto hos = himalaya::HierarchyCalculator::calculateDMh3L(points, isAlphab, workers);
+         REQUIRE(hos.size() == points.size());
+         for (std::size_t i = 0; i < points.size(); i++) {
+            INFO("Checking point " << i << " with " << workers << " workers");
+            CHECK(hos[i].getIsAlphab() == isAlphab);
+            CHECK(make_result(hos[i]) == expected[i]);
+         }
+      }
+   }
+
+   // a point without a suitable hierarchy
+   auto invalid_points = points;
+   invalid_points[3].mq2(0,0) = invalid_points[3].mq2(1,1) = 1e8;
+   CHECK_THROWS_AS(himalaya::HierarchyCalculator::calculateDMh3L(invalid_points, false, 2), std::runtime_error);
+}
+
+TEST_CASE("test_bucketed_batch")
+{
+   // points of different hierarchies in an interleaved order
+   std::vector<himalaya::Parameters> points;
+   for (const double mg: {0.75, 1.0, 1.25}) {
+      for (const double mu2: {0.3, 0.6, 1.0}) {
+         for (const double mq2: {0.5, 1.0}) {
+            auto point = make_point();
+            point.MG *= mg;
+            point.mu2(2,2) *= mu2;
+            point.mq2(2,2) *= mq2;
+            points.push_back(point);
+         }
+      }
+   }
+
+   std::vector<Result> expected;
+   std::set<int> hierarchies;
+   for (const auto& point: points) {
+      const himalaya::HierarchyCalculator hc(point, false);
+      expected.push_back(make_result(hc.calculateDMh3L(false)));
+      hierarchies.insert(expected.back().hierarchy);
+   }
+
+   REQUIRE(hierarchies.size() > 3);
+
+   himalaya::ThreadPool pool(3);
+   const auto hos = himalaya::HierarchyCalculator::calculateDMh3L(points, false, pool);
+   REQUIRE(hos.size() == points.size());
+
+   // the results are scattered back into the original order
+   for (std::size_t i = 0; i < points.size(); i++) {
+      INFO("Checking point " << i);
+      CHECK(make_result(hos[i]) == expected[i]);
+   }
+
+   // the pruning skips estimates, but selects the same hierarchies
+   const auto pruned = himalaya::HierarchyCalculator::calculateDMh3L(points, false, pool, true);
+   REQUIRE(pruned.size() == points.size());
+
+   int skipped = 0;
+   for (std::size_t i = 0; i < points.size(); i++) {
+      INFO("Checking pruned point " << i);
+      himalaya::HierarchyCalculator hc(points[i], false);
+      hc.setHierarchyPruning(true);
+      const auto ho = hc.calculateDMh3L(false);
+      CHECK(make_result(pruned[i]) == make_result(ho));
+      CHECK(pruned[i].getSkippedUncertaintyEstimates() == ho.getSkippedUncertaintyEstimates());
+      skipped += pruned[i].getSkippedUncertaintyEstimates();
+   }
+
+   CHECK(skipped > 0);
+}
+
+TEST_CASE("test_top_and_bottom")
+{
+   const himalaya::HierarchyCalculator hc(make_point(), false);
+
+   const Result expectedTop = make_result(hc.calculateDMh3L(false));
+   const Result expectedBottom = make_result(hc.calculateDMh3L(true));
+
+   for (int i = 0; i < number_of_calls; i++) {
+      const auto hos = hc.calculateDMh3LTopAndBottom();
+      CHECK(!hos[0].getIsAlphab());
+      CHECK(hos[1].getIsAlphab());
+      CHECK(make_result(hos[0]) == expectedTop);
+      CHECK(make_result(hos[1]) == expectedBottom);
+   }
+
+   const auto dmh = hc.calculateDMh3LTopAndBottom(himalaya::ResultFields::DMH);
+   CHECK(dmh[0].getDMh(3) == expectedTop.DMh3L);
+   CHECK(dmh[1].getDMh(3) == expectedBottom.DMh3L);
+}